@@ -0,0 +1,69 @@
+#
+# A common CMake file for consistently initializing and verifying the
+# SimpleITK_PIXEL_TYPES CMake variable, a reduced instantiation
+# profile of the pixel component types.
+#
+# The uint8, uint32, float32 and float64 component types are always
+# instantiated. The list SimpleITK_PIXEL_TYPES_INSTANTIATED is set to
+# all the component types which are enabled.
+#
+
+set(
+  SimpleITK_PIXEL_TYPES_ALL
+  int8
+  uint8
+  int16
+  uint16
+  int32
+  uint32
+  int64
+  uint64
+  float32
+  float64
+)
+set(
+  SimpleITK_PIXEL_TYPES_REQUIRED
+  uint8
+  uint32
+  float32
+  float64
+)
+
+set(
+  SimpleITK_PIXEL_TYPES
+  ""
+  CACHE STRING
+  "Semicolon separated list of the pixel component types to instantiate (int8, uint8, int16, uint16, int32, uint32, int64, uint64, float32, float64), empty for all."
+)
+mark_as_advanced(SimpleITK_PIXEL_TYPES)
+
+foreach(_type IN LISTS SimpleITK_PIXEL_TYPES)
+  if(NOT _type IN_LIST SimpleITK_PIXEL_TYPES_ALL)
+    message(
+      FATAL_ERROR
+      "Unknown pixel type \"${_type}\" in \"SimpleITK_PIXEL_TYPES\", expected one of: ${SimpleITK_PIXEL_TYPES_ALL}."
+    )
+  endif()
+endforeach()
+
+if(SimpleITK_PIXEL_TYPES)
+  set(SimpleITK_PIXEL_TYPES_INSTANTIATED "")
+  foreach(_type IN LISTS SimpleITK_PIXEL_TYPES_ALL)
+    if(
+      _type IN_LIST SimpleITK_PIXEL_TYPES
+      OR _type IN_LIST SimpleITK_PIXEL_TYPES_REQUIRED
+    )
+      list(APPEND SimpleITK_PIXEL_TYPES_INSTANTIATED ${_type})
+    endif()
+  endforeach()
+  message(
+    STATUS
+    "SimpleITK instantiated pixel types: ${SimpleITK_PIXEL_TYPES_INSTANTIATED}"
+  )
+else()
+  set(SimpleITK_PIXEL_TYPES_INSTANTIATED ${SimpleITK_PIXEL_TYPES_ALL})
+endif()
+
+if(NOT SimpleITK_INT64_PIXELIDS)
+  list(REMOVE_ITEM SimpleITK_PIXEL_TYPES_INSTANTIATED int64 uint64)
+endif()
@@ -65,6 +65,17 @@ namespace itk::simple
  * provides a DynamicThreadedGenerateData() method for its
  * implementation.
  *
+ * When the extracted region is contiguous in the input's buffer,
+ * such as slices along the slowest dimensions, the output is a view
+ * which shares the input's buffer without copying pixels. The shared
+ * buffer is copied before either image is modified, and the input's
+ * buffer is kept alive while the view exists. For a view the ITK
+ * filter only computes the output information and no pixels are
+ * processed, but the StartEvent and EndEvent are still invoked, so
+ * the commands, the measurements and the execution timeout apply
+ * as when the filter is updated. No ProgressEvent or IterationEvent
+ * is invoked for a view.
+ *
  * \see CropImageFilter
  * \sa itk::simple::Extract for the procedural interface
  * \sa itk::ExtractImageFilter for the Doxygen on the original ITK class.
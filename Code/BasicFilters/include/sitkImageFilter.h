@@ -62,31 +62,27 @@ protected:
   static void
   FixNonZeroIndex(TImageType * img)
   {
-    assert(img);
-
-    typename TImageType::RegionType r = img->GetLargestPossibleRegion();
-    typename TImageType::IndexType  idx = r.GetIndex();
-
-    for (unsigned int i = 0; i < TImageType::ImageDimension; ++i)
-    {
-
-      if (idx[i] != 0)
-      {
-        // if any of the indicies are non-zero, then just fix it
-        typename TImageType::PointType o;
-        img->TransformIndexToPhysicalPoint(idx, o);
-        img->SetOrigin(o);
-
-        idx.Fill(0);
-        r.SetIndex(idx);
+    itk::simple::FixNonZeroIndex(img);
+  }
 
-        // Need to set the buffered region to match largest
-        img->SetRegions(r);
+  /** Update the output of the ITK filter in the number of stream
+   * divisions, when it is greater than one and a division of the
+   * output requests only divisions of the image inputs. Otherwise
+   * the filter is not updated and a null pointer is returned.
+   *
+   * The implementation in sitkImageFilter.hxx needs to be manually
+   * included when this method is used.
+   */
+  template <class TFilterType>
+  typename TFilterType::OutputImageType::Pointer
+  UpdateStreamed(TFilterType * filter);
 
-        return;
-      }
-    }
-  }
+  /** Returns true if updating a division of the primary output of
+   * the ITK filter requests divisions of its image inputs, and not
+   * the whole images.
+   */
+  static bool
+  IsStreamable(itk::ProcessObject * filter);
 
   /** Verify the dimension of image1 matches the dimension of
    * image2, and if not then an exception is thrown.
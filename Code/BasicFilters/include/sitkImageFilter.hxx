@@ -0,0 +1,58 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef sitkImageFilter_hxx
+#define sitkImageFilter_hxx
+
+#include "sitkImageFilter.h"
+#include "sitkPixelIDTokens.h"
+
+#include "itkStreamingImageFilter.h"
+
+namespace itk::simple
+{
+
+template <class TFilterType>
+typename TFilterType::OutputImageType::Pointer
+ImageFilter::UpdateStreamed(TFilterType * filter)
+{
+  using OutputImageType = typename TFilterType::OutputImageType;
+
+  // label maps can not be updated in divisions
+  if constexpr (IsBasic<OutputImageType>::Value || IsVector<OutputImageType>::Value)
+  {
+    if (this->GetNumberOfStreamDivisions() > 1 && IsStreamable(filter))
+    {
+      sitkDebugMacro("Updating ITK filter in " << this->GetNumberOfStreamDivisions() << " divisions.");
+
+      using StreamerType = itk::StreamingImageFilter<OutputImageType, OutputImageType>;
+      typename StreamerType::Pointer streamer = StreamerType::New();
+      streamer->SetInput(filter->GetOutput());
+      streamer->SetNumberOfStreamDivisions(this->GetNumberOfStreamDivisions());
+      this->UpdateWithTimeout(streamer.GetPointer());
+
+      typename OutputImageType::Pointer output = streamer->GetOutput();
+      output->DisconnectPipeline();
+      return output;
+    }
+  }
+  return nullptr;
+}
+
+} // namespace itk::simple
+
+#endif
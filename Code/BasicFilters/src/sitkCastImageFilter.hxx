@@ -50,7 +50,7 @@ CastImageFilter::ExecuteInternalCast(const Image & inImage)
 
   this->PreUpdate(filter.GetPointer());
 
-  filter->Update();
+  this->UpdateWithTimeout(filter.GetPointer());
 
   return Image(filter->GetOutput());
 }
@@ -79,7 +79,7 @@ CastImageFilter::ExecuteInternalToVector(const Image & inImage)
 
   sitkDebugMacro(<< "Executing ITK filters:" << std::endl << filter << caster);
 
-  caster->Update();
+  this->UpdateWithTimeout(caster.GetPointer());
 
   return Image(caster->GetOutput());
 }
@@ -101,7 +101,7 @@ CastImageFilter::ExecuteInternalToLabel(const Image & inImage)
 
   this->PreUpdate(filter.GetPointer());
 
-  filter->Update();
+  this->UpdateWithTimeout(filter.GetPointer());
 
   return Image(filter->GetOutput());
 }
@@ -123,7 +123,7 @@ CastImageFilter::ExecuteInternalLabelToImage(const Image & inImage)
 
   this->PreUpdate(filter.GetPointer());
 
-  filter->Update();
+  this->UpdateWithTimeout(filter.GetPointer());
 
   return Image(filter->GetOutput());
 }
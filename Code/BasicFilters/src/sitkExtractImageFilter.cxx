@@ -27,6 +27,7 @@
 
 #include "sitkExtractImageFilter.h"
 #include "itkExtractImageFilter.h"
+#include "itkViewImportImageContainer.h"
 
 
 namespace itk::simple
@@ -118,7 +119,49 @@ ExtractImageFilter::Execute(Image && image1)
 // Custom Casts
 //
 namespace
-{}
+{
+
+// Returns true if the region is inside the largest possible region of
+// the image, and the pixels of the region are contiguous in the
+// image's buffer. The region's size may contain zeros for collapsed
+// dimensions.
+template <class TImageType>
+bool
+IsContiguousBufferedRegion(const TImageType * image, typename TImageType::RegionType region)
+{
+  const typename TImageType::RegionType & bufferedRegion = image->GetBufferedRegion();
+
+  for (unsigned int i = 0; i < TImageType::ImageDimension; ++i)
+  {
+    if (region.GetSize(i) == 0)
+    {
+      region.SetSize(i, 1);
+    }
+  }
+
+  if (!bufferedRegion.IsInside(region))
+  {
+    return false;
+  }
+
+  // All dimensions faster than the slowest dimension with more than
+  // one pixel must be complete.
+  bool slowerDimension = false;
+  for (int i = TImageType::ImageDimension - 1; i >= 0; --i)
+  {
+    if (slowerDimension && region.GetSize(i) != bufferedRegion.GetSize(i))
+    {
+      return false;
+    }
+    if (region.GetSize(i) > 1)
+    {
+      slowerDimension = true;
+    }
+  }
+  return true;
+}
+
+} // namespace
 
 //-----------------------------------------------------------------------------
 
@@ -189,10 +232,51 @@ ExtractImageFilter::ExecuteInternal(const TImageType * image1,
     typename FilterType::DirectionCollapseStrategyEnum(int(this->m_DirectionCollapseToStrategy)));
   filter->SetInPlace(m_InPlace);
 
+  if (IsContiguousBufferedRegion(image1, itkRegion))
+  {
+    // The output is a view of the input's buffer, only the output
+    // information is computed by the ITK filter. The events are
+    // invoked so the commands and measurements are the same as when
+    // the filter is updated.
+    this->PreUpdate(filter.GetPointer());
+    filter->InvokeEvent(itk::StartEvent());
+    filter->UpdateOutputInformation();
+
+    typename OutputImageType::Pointer itkOutImage{ filter->GetOutput() };
+    itkOutImage->DisconnectPipeline();
+
+    itkOutImage->SetBufferedRegion(itkOutImage->GetLargestPossibleRegion());
+
+    using InternalPixelType = typename InputImageType::InternalPixelType;
+    size_t numberOfElementsPerPixel = 1;
+    if constexpr (IsVector<InputImageType>::Value)
+    {
+      numberOfElementsPerPixel = image1->GetNumberOfComponentsPerPixel();
+      itkOutImage->SetNumberOfComponentsPerPixel(numberOfElementsPerPixel);
+    }
+
+    const InternalPixelType * regionBuffer =
+      image1->GetBufferPointer() + image1->ComputeOffset(itkRegion.GetIndex()) * numberOfElementsPerPixel;
+    {
+      using ContainerType = itk::ViewImportImageContainer<itk::SizeValueType, InternalPixelType>;
+      auto container = ContainerType::New();
+      container->SetImportPointer(const_cast<InternalPixelType *>(regionBuffer),
+                                  itkOutImage->GetBufferedRegion().GetNumberOfPixels() * numberOfElementsPerPixel,
+                                  image1);
+      itkOutImage->SetPixelContainer(container);
+    }
+
+    filter->InvokeEvent(itk::EndEvent());
+    filter = nullptr;
+
+    this->FixNonZeroIndex(itkOutImage.GetPointer());
+    return Image{ this->CastITKToImage(itkOutImage.GetPointer()) };
+  }
+
   this->PreUpdate(filter.GetPointer());
 
   // Run the ITK filter and return the output as a SimpleITK image
-  filter->Update();
+  this->UpdateWithTimeout(filter.GetPointer());
 
   typename FilterType::OutputImageType::Pointer itkOutImage{ filter->GetOutput() };
   filter = nullptr;
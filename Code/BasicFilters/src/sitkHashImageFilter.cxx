@@ -134,7 +134,7 @@ HashImageFilter::ExecuteInternal(const Image & inImage)
 
   this->PreUpdate(hasher.GetPointer());
 
-  hasher->Update();
+  this->UpdateWithTimeout(hasher.GetPointer());
 
   return hasher->GetHash();
 }
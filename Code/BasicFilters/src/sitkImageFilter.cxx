@@ -18,6 +18,7 @@
 #include "sitkImageFilter.h"
 
 #include "itkProcessObject.h"
+#include "itkImageBase.h"
 
 #include <iostream>
 
@@ -72,6 +73,54 @@ CheckImageMatchingSize(const Image &       image1,
   }
 }
 
+template <unsigned int VImageDimension>
+bool
+IsStreamable(itk::ProcessObject * filter)
+{
+  auto * output = dynamic_cast<itk::ImageBase<VImageDimension> *>(filter->GetPrimaryOutput());
+  if (output == nullptr)
+  {
+    if constexpr (VImageDimension < SITK_MAX_DIMENSION)
+    {
+      return IsStreamable<VImageDimension + 1>(filter);
+    }
+    return false;
+  }
+
+  output->UpdateOutputInformation();
+
+  typename itk::ImageBase<VImageDimension>::RegionType region = output->GetLargestPossibleRegion();
+  if (region.GetSize(VImageDimension - 1) < 2)
+  {
+    return false;
+  }
+
+  // Request the first slice of the output, and check which regions
+  // are requested of the inputs.
+  region.SetSize(VImageDimension - 1, 1);
+  output->SetRequestedRegion(region);
+  output->PropagateRequestedRegion();
+
+  bool streamable = false;
+  for (const auto & input : filter->GetInputs())
+  {
+    const auto * image = dynamic_cast<const itk::ImageBase<VImageDimension> *>(input.GetPointer());
+    if (image == nullptr)
+    {
+      continue;
+    }
+    if (image->GetRequestedRegion() == image->GetLargestPossibleRegion())
+    {
+      streamable = false;
+      break;
+    }
+    streamable = true;
+  }
+
+  output->SetRequestedRegionToLargestPossibleRegion();
+  return streamable;
+}
+
 } // namespace
 
 
@@ -82,6 +131,13 @@ ImageFilter::ImageFilter() = default;
 ImageFilter::~ImageFilter() = default;
 
 
+bool
+ImageFilter::IsStreamable(itk::ProcessObject * filter)
+{
+  assert(filter);
+  return itk::simple::IsStreamable<2>(filter);
+}
+
 void
 ImageFilter::CheckImageMatchingDimension(const Image & image1, const Image & image2, const std::string & image2Name)
 {
@@ -250,7 +250,7 @@ PasteImageFilter::ExecuteInternal(const TImageType * destinationImage,
 
 
   // Run the ITK filter and return the output as a SimpleITK image
-  filter->Update();
+  this->UpdateWithTimeout(filter.GetPointer());
 
   typename FilterType::OutputImageType::Pointer itkOutImage{ filter->GetOutput() };
   filter = nullptr;
@@ -317,7 +317,7 @@ PasteImageFilter::ExecuteInternal(const Image * inDestinationImage, double const
 
 
   // Run the ITK filter and return the output as a SimpleITK image
-  filter->Update();
+  this->UpdateWithTimeout(filter.GetPointer());
 
   typename FilterType::OutputImageType::Pointer itkOutImage{ filter->GetOutput() };
   filter = nullptr;
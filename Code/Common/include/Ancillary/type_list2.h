@@ -143,6 +143,35 @@ template <typename... Ts, typename T>
 struct has_type<typelist<Ts...>, T> : std::integral_constant<bool, ((std::is_same<Ts, T>::value) || ...)>
 {};
 
+/**\class filter
+ * \brief Selects the types of a typelist which satisfy a predicate
+ *
+ * Example:
+ * \code
+ * using MyTypeList = typelist2::typelist<int, char, float>;
+ * using MyIntegralList = typelist2::filter<MyTypeList, std::is_integral>::type;
+ * \endcode
+ *
+ * The member type `type` definition is a new typelist of the types
+ * for which Predicate<T>::value is true, in the original order.
+ */
+template <typename Typelist, template <typename> class Predicate>
+struct filter;
+template <template <typename> class Predicate>
+struct filter<typelist<>, Predicate>
+{
+  using type = typelist<>;
+};
+template <typename T, typename... Ts, template <typename> class Predicate>
+struct filter<typelist<T, Ts...>, Predicate>
+{
+private:
+  using tail = typename filter<typelist<Ts...>, Predicate>::type;
+
+public:
+  using type = typename std::conditional<Predicate<T>::value, typename append<typelist<T>, tail>::type, tail>::type;
+};
+
 /**\class visit
  * \brief Runs a templated predicate on each type in the typelist
  *
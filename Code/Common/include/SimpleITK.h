@@ -36,6 +36,8 @@
 #include "sitkDetail.h"
 #include "sitkVersion.h"
 #include "sitkImage.h"
+#include "sitkImageMemoryStatistics.h"
+#include "sitkBinaryMask.h"
 #include "sitkTransform.h"
 #include "sitkBSplineTransform.h"
 #include "sitkDisplacementFieldTransform.h"
@@ -58,12 +60,16 @@
 #include "sitkEvent.h"
 #include "sitkRandomSeed.h"
 
+#include "sitkExecutionStatistics.h"
+#include "sitkExecutionTrace.h"
+#include "sitkResultCache.h"
 #include "sitkProcessObject.h"
 #include "sitkImageFilter.h"
 #include "sitkObjectOwnedBase.h"
 #include "sitkCommand.h"
 #include "sitkFunctionCommand.h"
 #include "sitkLogger.h"
+#include "sitkPixelBufferAllocator.h"
 
 // IO classes
 #include "sitkImageFileReader.h"
@@ -0,0 +1,97 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkDeleterImportImageContainer_h
+#define itkDeleterImportImageContainer_h
+
+#include "itkImportImageContainer.h"
+
+#include <functional>
+
+namespace itk
+{
+
+/** \class DeleterImportImageContainer
+ *  \brief An ImportImageContainer which releases an imported buffer with a deleter
+ *
+ * When a buffer is imported with a deleter, the container does not
+ * manage the memory. Instead the deleter is called with the imported
+ * pointer when the container is destroyed. This enables the lifetime
+ * of an external buffer, such as a memory mapped file or memory
+ * owned by another library, to be tied to the lifetime of the ITK
+ * image it is the pixel container for.
+ */
+template <typename TElementIdentifier, typename TElement>
+class DeleterImportImageContainer : public ImportImageContainer<TElementIdentifier, TElement>
+{
+public:
+  using Self = DeleterImportImageContainer;
+  using Superclass = ImportImageContainer<TElementIdentifier, TElement>;
+
+  using Pointer = SmartPointer<Self>;
+  using ConstPointer = SmartPointer<const Self>;
+
+  using ElementIdentifier = TElementIdentifier;
+  using Element = TElement;
+
+  using DeleterType = std::function<void(void *)>;
+
+  itkNewMacro(Self);
+
+  itkTypeMacro(DeleterImportImageContainer, ImportImageContainer);
+
+  /** Import a buffer which is released by calling the deleter with
+   * ptr, when this container is destroyed or another buffer is
+   * imported. */
+  void
+  SetImportPointer(TElement * ptr, TElementIdentifier num, DeleterType deleter)
+  {
+    this->ReleaseImportPointer();
+    Superclass::SetImportPointer(ptr, num, false);
+    this->m_DeleterPointer = ptr;
+    this->m_Deleter = std::move(deleter);
+  }
+  using Superclass::SetImportPointer;
+
+  DeleterImportImageContainer(const Self &) = delete;
+  void
+  operator=(const Self &) = delete;
+
+protected:
+  DeleterImportImageContainer() = default;
+  ~DeleterImportImageContainer() override { this->ReleaseImportPointer(); }
+
+private:
+  void
+  ReleaseImportPointer()
+  {
+    if (this->m_Deleter)
+    {
+      DeleterType deleter;
+      std::swap(deleter, this->m_Deleter);
+      deleter(this->m_DeleterPointer);
+    }
+    this->m_DeleterPointer = nullptr;
+  }
+
+  TElement *  m_DeleterPointer{ nullptr };
+  DeleterType m_Deleter;
+};
+
+} // namespace itk
+
+#endif
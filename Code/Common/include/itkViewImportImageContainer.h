@@ -0,0 +1,73 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkViewImportImageContainer_h
+#define itkViewImportImageContainer_h
+
+#include "itkDeleterImportImageContainer.h"
+
+namespace itk
+{
+
+/** \class ViewImportImageContainer
+ *  \brief A pixel container referencing the buffer of another object.
+ *
+ * The container imports a pointer into memory owned by another
+ * object, such as a region of the buffer of another image. A
+ * reference to the owner is held by the container so the memory
+ * remains valid for the lifetime of the container.
+ *
+ * The buffer is shared with the owner, so the type of the container
+ * identifies images which must be copied before being modified.
+ */
+template <typename TElementIdentifier, typename TElement>
+class ViewImportImageContainer : public DeleterImportImageContainer<TElementIdentifier, TElement>
+{
+public:
+  using Self = ViewImportImageContainer;
+  using Superclass = DeleterImportImageContainer<TElementIdentifier, TElement>;
+
+  using Pointer = SmartPointer<Self>;
+  using ConstPointer = SmartPointer<const Self>;
+
+  using ElementIdentifier = TElementIdentifier;
+  using Element = TElement;
+
+  itkNewMacro(Self);
+
+  itkTypeMacro(ViewImportImageContainer, DeleterImportImageContainer);
+
+  /** Reference num elements at ptr, which are owned by owner. */
+  void
+  SetImportPointer(TElement * ptr, TElementIdentifier num, const Object * owner)
+  {
+    Superclass::SetImportPointer(
+      ptr, num, [ownerPointer = Object::ConstPointer(owner)](void *) mutable { ownerPointer = nullptr; });
+  }
+
+  ViewImportImageContainer(const Self &) = delete;
+  void
+  operator=(const Self &) = delete;
+
+protected:
+  ViewImportImageContainer() = default;
+  ~ViewImportImageContainer() override = default;
+};
+
+} // namespace itk
+
+#endif
@@ -0,0 +1,237 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef sitkBinaryMask_h
+#define sitkBinaryMask_h
+
+#include "sitkCommon.h"
+#include "sitkImage.h"
+
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace itk::simple
+{
+
+/** \class BinaryMask
+ * \brief A binary mask with the pixels packed into bits.
+ *
+ * A BinaryMask stores one bit per pixel, so it uses an eighth of the
+ * memory of a sitkUInt8 image with the same size. The pixels are
+ * packed into 64-bit words in the same order as an Image buffer,
+ * with the first dimension varying fastest. The BinaryMask keeps the
+ * origin, spacing and direction of the image it was created from.
+ *
+ * Logical operations and counting of the pixels which are on are
+ * performed a word at a time.
+ *
+ * A BinaryMask is converted to a sitkUInt8 image with pixel values
+ * of 0 and 1 with the ToImage method. The converted image can be
+ * used with the MaskImageFilter, LabelShapeStatisticsImageFilter,
+ * ImageRegistrationMethod::SetMetricFixedMask and written with the
+ * ImageFileWriter.
+ */
+class SITKCommon_EXPORT BinaryMask
+{
+public:
+  using Self = BinaryMask;
+  using WordType = uint64_t;
+
+  /** \brief Construct an empty mask of dimension 0. */
+  BinaryMask();
+
+  /** \brief Construct a mask with all pixels off.
+   *
+   * An exception is thrown if the dimension of the size is not
+   * supported for an Image.
+   */
+  explicit BinaryMask(const std::vector<unsigned int> & size);
+
+  /** \brief Construct a mask from an image.
+   *
+   * Pixels with a non-zero value are on. The image must have a
+   * scalar integer pixel type, otherwise an exception is thrown. The
+   * origin, spacing and direction of the image are copied.
+   */
+  explicit BinaryMask(const Image & image);
+
+  BinaryMask(const BinaryMask &);
+  BinaryMask(BinaryMask &&) noexcept;
+  BinaryMask &
+  operator=(const BinaryMask &);
+  BinaryMask &
+  operator=(BinaryMask &&) noexcept;
+  ~BinaryMask();
+
+  /** \brief Convert to a sitkUInt8 image with pixel values 0 and 1. */
+  Image
+  ToImage() const;
+
+  unsigned int
+  GetDimension() const;
+
+  std::vector<unsigned int>
+  GetSize() const;
+
+  uint64_t
+  GetNumberOfPixels() const;
+
+  /** Get/Set the Origin in physical space
+   * @{
+   */
+  std::vector<double>
+  GetOrigin() const;
+  void
+  SetOrigin(const std::vector<double> & origin);
+  /** @} */
+
+  /** Get/Set the Spacing in physical space
+   * @{
+   */
+  std::vector<double>
+  GetSpacing() const;
+  void
+  SetSpacing(const std::vector<double> & spacing);
+  /** @} */
+
+  /** \brief Get/Set the Direction as a row-major matrix
+   * @{
+   */
+  std::vector<double>
+  GetDirection() const;
+  void
+  SetDirection(const std::vector<double> & direction);
+  /** @} */
+
+  /** \brief Get/Set the value of a pixel.
+   *
+   * An exception is thrown if the index is out of bounds.
+   * @{
+   */
+  bool
+  GetPixel(const std::vector<uint32_t> & idx) const;
+  void
+  SetPixel(const std::vector<uint32_t> & idx, bool value);
+  /** @} */
+
+  /** \brief Set all pixels on or off. */
+  void
+  Fill(bool value);
+
+  /** \brief The number of pixels which are on. */
+  uint64_t
+  CountOn() const;
+
+  /** \brief Logical operations with another mask.
+   *
+   * The masks must have the same size, otherwise an exception is
+   * thrown. The meta-data of this mask is kept.
+   * @{
+   */
+  BinaryMask &
+  And(const BinaryMask & other);
+  BinaryMask &
+  Or(const BinaryMask & other);
+  BinaryMask &
+  Xor(const BinaryMask & other);
+  /** @} */
+
+  /** \brief Invert all pixels of the mask. */
+  BinaryMask &
+  Not();
+
+  /** \brief The number of bytes used to store the pixels. */
+  uint64_t
+  GetNumberOfBytes() const;
+
+  std::string
+  ToString() const;
+
+#ifndef SWIG
+  /** Access to the packed words of the mask. Bits past the last
+   * pixel are always zero.
+   * @{
+   */
+  const std::vector<WordType> &
+  GetWords() const
+  {
+    return m_Words;
+  }
+  /** @} */
+
+  BinaryMask &
+  operator&=(const BinaryMask & other)
+  {
+    return this->And(other);
+  }
+  BinaryMask &
+  operator|=(const BinaryMask & other)
+  {
+    return this->Or(other);
+  }
+  BinaryMask &
+  operator^=(const BinaryMask & other)
+  {
+    return this->Xor(other);
+  }
+#endif
+
+private:
+  void
+  CheckSameSize(const BinaryMask & other) const;
+
+  uint64_t
+  ComputeOffset(const std::vector<uint32_t> & idx) const;
+
+  void
+  ClearTrailingBits();
+
+  std::vector<unsigned int> m_Size;
+  std::vector<double>       m_Origin;
+  std::vector<double>       m_Spacing;
+  std::vector<double>       m_Direction;
+  std::vector<WordType>     m_Words;
+};
+
+#ifndef SWIG
+inline BinaryMask
+operator&(BinaryMask lhs, const BinaryMask & rhs)
+{
+  return std::move(lhs.And(rhs));
+}
+inline BinaryMask
+operator|(BinaryMask lhs, const BinaryMask & rhs)
+{
+  return std::move(lhs.Or(rhs));
+}
+inline BinaryMask
+operator^(BinaryMask lhs, const BinaryMask & rhs)
+{
+  return std::move(lhs.Xor(rhs));
+}
+inline BinaryMask
+operator~(BinaryMask mask)
+{
+  return std::move(mask.Not());
+}
+#endif
+
+} // namespace itk::simple
+
+#endif
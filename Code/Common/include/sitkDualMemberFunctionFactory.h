@@ -74,6 +74,7 @@ public:
   using MemberFunctionType = TMemberFunctionPointer;
   using ObjectType = typename ::detail::FunctionTraits<MemberFunctionType>::ClassType;
   using FunctionObjectType = typename Superclass::FunctionObjectType;
+  using BoundFunctionObjectType = typename Superclass::BoundFunctionObjectType;
 
   /** \brief Constructor which permanently binds the constructed
    * object to pObject */
@@ -180,7 +181,7 @@ public:
    *  exception is generated. The returned function object is
    *  guaranteed to be valid.
    */
-  FunctionObjectType
+  BoundFunctionObjectType
   GetMemberFunction(PixelIDValueType pixelID1,
                     PixelIDValueType pixelID2,
                     unsigned int     imageDimension,
@@ -140,7 +140,7 @@ DualMemberFunctionFactory<TMemberFunctionPointer, TContainer>::HasMemberFunction
 }
 
 template <typename TMemberFunctionPointer, typename TContainer>
-typename DualMemberFunctionFactory<TMemberFunctionPointer, TContainer>::FunctionObjectType
+typename DualMemberFunctionFactory<TMemberFunctionPointer, TContainer>::BoundFunctionObjectType
 DualMemberFunctionFactory<TMemberFunctionPointer, TContainer>::GetMemberFunction(
   PixelIDValueType                                                                     pixelID1,
   PixelIDValueType                                                                     pixelID2,
@@ -109,6 +109,45 @@ private:
   std::shared_ptr<const ExceptionObject> m_PimpleException;
 };
 
+/** \class TimeoutException
+ * \brief Exception thrown when an execution is aborted because its
+ * timeout expired.
+ *
+ * \sa ProcessObject::SetExecutionTimeout
+ */
+class SITKCommon_EXPORT TimeoutException : public GenericException
+{
+public:
+  TimeoutException() noexcept;
+  TimeoutException(const TimeoutException & e) noexcept;
+
+  TimeoutException(const std::string & file,
+                   unsigned int        lineNumber,
+                   const std::string & desc,
+                   float               progress,
+                   double              elapsedTime) noexcept;
+
+  ~TimeoutException() noexcept override;
+
+  TimeoutException &
+  operator=(const TimeoutException & orig);
+
+  const char *
+  GetNameOfClass() const override;
+
+  /** The progress of the execution, in [0,1], when it was aborted. */
+  float
+  GetProgress() const;
+
+  /** The wall time in seconds of the execution until it was aborted. */
+  double
+  GetElapsedTime() const;
+
+private:
+  float  m_Progress{ 0.0f };
+  double m_ElapsedTime{ 0.0 };
+};
+
 #ifdef _MSC_VER
 #  pragma warning(pop)
 #endif
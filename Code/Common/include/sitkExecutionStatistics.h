@@ -0,0 +1,98 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef sitkExecutionStatistics_h
+#define sitkExecutionStatistics_h
+
+#include "sitkCommon.h"
+
+#include <cstdint>
+#include <string>
+
+namespace itk::simple
+{
+
+/** \brief Measurements of one execution of a ProcessObject.
+ *
+ * The measurements are made between the StartEvent and the EndEvent
+ * of the ITK process object run by Execute.
+ *
+ * The pixel buffer sizes are known for the image types of SimpleITK
+ * images, the buffers of other data objects are not included.
+ *
+ * \sa ProcessObject::GetLastExecutionStatistics
+ */
+struct SITKCommon_EXPORT ExecutionStatistics
+{
+  /** The name of the ProcessObject. */
+  std::string Name;
+
+  /** Elapsed wall clock time in seconds. */
+  double WallTime{ 0.0 };
+
+  /** Processor time of the process, summed over all threads, in
+   * seconds.
+   *
+   * The processor time is measured for the whole process, so the
+   * work of the ITK threads of the execution is included. It also
+   * includes the work of any other thread of the process during the
+   * execution, such as another execution with ExecuteAsync,
+   * ExecuteBatch or a multi-threaded image series reader or writer.
+   * The value is only meaningful when executions do not overlap. */
+  double CPUTime{ 0.0 };
+
+  /** The maximum number of threads of the multi-threader. */
+  unsigned int NumberOfThreads{ 0 };
+
+  /** The number of work units of the ITK process object. */
+  unsigned int NumberOfWorkUnits{ 0 };
+
+  /** The bytes of the pixel buffers of the inputs. */
+  uint64_t InputBytes{ 0 };
+
+  /** The bytes of the pixel buffers of the outputs. */
+  uint64_t OutputBytes{ 0 };
+
+  /** The bytes of the output pixel buffers which are not buffers of
+   * an input, that is the pixel memory allocated by the execution. */
+  uint64_t AllocatedBytes{ 0 };
+};
+
+/** \brief Measurements of all executions of ProcessObjects with the
+ * same name.
+ *
+ * \sa ProcessObject::GetGlobalExecutionStatistics
+ */
+struct SITKCommon_EXPORT ExecutionStatisticsSummary
+{
+  std::string Name;
+
+  uint64_t NumberOfExecutions{ 0 };
+
+  double TotalWallTime{ 0.0 };
+  double MaximumWallTime{ 0.0 };
+  /** The sum of ExecutionStatistics::CPUTime, which is process wide. */
+  double TotalCPUTime{ 0.0 };
+
+  uint64_t TotalInputBytes{ 0 };
+  uint64_t TotalOutputBytes{ 0 };
+  uint64_t TotalAllocatedBytes{ 0 };
+};
+
+} // namespace itk::simple
+
+#endif
@@ -0,0 +1,112 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef sitkExecutionTrace_h
+#define sitkExecutionTrace_h
+
+#include "sitkCommon.h"
+#include "sitkNonCopyable.h"
+#include "sitkPathType.h"
+
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace itk::simple
+{
+
+/** \brief Start recording a trace of the execution of all
+ * ProcessObjects.
+ *
+ * While tracing is enabled a span is recorded for each Execute of a
+ * filter, reader or writer, with nested spans for the update of the
+ * ITK process and the conversion of the output. The registration
+ * method adds spans for each resolution level and optimizer
+ * iteration.
+ *
+ * The trace is kept in memory until it is written with
+ * WriteExecutionTrace or cleared.
+ *
+ * \sa WriteExecutionTrace
+ */
+SITKCommon_EXPORT void
+StartExecutionTrace();
+
+/** \brief Stop recording the execution trace, the recorded events are
+ * kept. */
+SITKCommon_EXPORT void
+StopExecutionTrace();
+
+/** \brief Query if the execution trace is being recorded. */
+SITKCommon_EXPORT bool
+IsExecutionTraceEnabled();
+
+/** \brief Remove all recorded events from the execution trace. */
+SITKCommon_EXPORT void
+ClearExecutionTrace();
+
+/** \brief Write the recorded execution trace as a JSON file.
+ *
+ * The file is in the Trace Event Format, which can be loaded into the
+ * chrome://tracing viewer or Perfetto. The spans are labeled with the
+ * process id and a thread number, so traces of multiple processes can
+ * be loaded together.
+ */
+SITKCommon_EXPORT void
+WriteExecutionTrace(const PathType & fileName);
+
+#ifndef SWIG
+
+/** \brief The current time of the execution trace's clock in
+ * seconds. */
+SITKCommon_EXPORT double
+GetExecutionTraceTime();
+
+/** \brief Add a span to the execution trace if tracing is enabled.
+ *
+ * The start and end times are from GetExecutionTraceTime. The
+ * arguments are name and value pairs shown with the span.
+ */
+SITKCommon_EXPORT void
+AddExecutionTraceEvent(const std::string &                                       name,
+                       const std::string &                                       category,
+                       double                                                    startTime,
+                       double                                                    endTime,
+                       const std::vector<std::pair<std::string, std::string>> & args = {});
+
+/** \class ExecutionTraceScope
+ * \brief Add a span for the lifetime of this object to the execution
+ * trace.
+ */
+class SITKCommon_EXPORT ExecutionTraceScope : protected NonCopyable
+{
+public:
+  ExecutionTraceScope(std::string name, std::string category);
+  ~ExecutionTraceScope();
+
+private:
+  std::string m_Name;
+  std::string m_Category;
+  double      m_StartTime;
+  bool        m_Enabled;
+};
+
+#endif
+
+} // namespace itk::simple
+
+#endif
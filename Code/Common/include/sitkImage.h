@@ -33,6 +33,7 @@ namespace itk
 
 // Forward declaration for pointer
 class DataObject;
+class ProcessObject;
 
 template <class T>
 class SmartPointer;
@@ -46,6 +47,9 @@ namespace simple
 // idiom.
 class PimpleImageBase;
 
+class PixelBufferAllocator;
+class ProcessObject;
+
 /** \class Image
  * \brief The Image class for SimpleITK
  *
@@ -144,6 +148,23 @@ public:
   Image(const std::vector<unsigned int> & size, PixelIDValueEnum valueEnum, unsigned int numberOfComponents = 0);
   /**@}*/
 
+  /** \brief Create an image without initializing the pixel buffer.
+   *
+   * The size, pixel type and number of components are the same as
+   * with the constructor. The pixel buffer is allocated, but the
+   * values of the pixels are undefined. The memory is not written,
+   * so for large images the cost of filling the buffer and of the
+   * operating system committing every page is avoided. The image is
+   * intended to be completely overwritten after it is created.
+   *
+   * Label map pixel types have no pixel buffer and are created the
+   * same as with the constructor.
+   */
+  static Image
+  CreateUninitialized(const std::vector<unsigned int> & size,
+                      PixelIDValueEnum                  valueEnum,
+                      unsigned int                      numberOfComponents = 0);
+
 
   /** \brief Construct an SimpleITK Image from an pointer to an ITK
    * image
@@ -335,6 +356,28 @@ public:
   std::vector<double>
   EvaluateAtPhysicalPoint(const std::vector<double> & point, InterpolatorEnum interp = sitkLinear) const;
 
+  /** Interpolate pixel values at many physical points.
+   *
+   * This method is not supported for Label pixel types.
+   *
+   * The points are provided as a flat array of length n*GetDimension(), where the coordinates of the i-th point are
+   * [points[i*D], ..., points[i*D+D-1]] for an image of dimension D. The interpolator is constructed and initialized
+   * only once, which avoids recomputing the coefficients of the sitkBSpline interpolators for each point, and the
+   * points are evaluated in parallel with the ITK global default number of threads.
+   *
+   * An exception is thrown if any point is out of the defined region for the image.
+   *
+   * @param points The physical points at which the interpolation is computed.
+   * @param interp The interpolation type to use, only sitkNearest and sitkLinear are supported for Vector and Complex
+   * pixel types.
+   *
+   * @return A flat array with the result of EvaluateAtPhysicalPoint for each point consecutively. Each point has
+   * GetNumberOfComponentsPerPixel() values for vector pixel types, two values for complex pixel types and one value
+   * otherwise.
+   */
+  std::vector<double>
+  EvaluateAtPhysicalPoints(const std::vector<double> & points, InterpolatorEnum interp = sitkLinear) const;
+
 
   /** Checks whether the images' pixels at the same index occupy the same physical space.
    *
@@ -603,6 +646,79 @@ public:
 
   /** @} */
 
+  /** \brief Get the values of many pixels with a single call
+   *
+   * The indices are provided as a flat array of length n*GetDimension(), where the index of the i-th pixel is
+   * [indices[i*D], ..., indices[i*D+D-1]] for an image of dimension D. The pixel type is dispatched once per call and
+   * the values are copied directly from the image's buffer, which is significantly more efficient than repeated calls
+   * to the GetPixelAs methods when accessing many scattered pixels.
+   *
+   * Similar to the GetBufferAs methods, vector and complex pixel types are accessed via the method for their component
+   * type. The returned array contains all components of each pixel consecutively, that is GetNumberOfComponentsPerPixel()
+   * values per pixel for vector images and the real followed by the imaginary part for complex images. Label pixel
+   * types are accessed via the method of their label type.
+   *
+   * Boundary checking is performed on every index, if any is out of bounds an exception will be thrown.
+   *
+   * \sa Image::GetPixelIDValue Image::SetPixelsAsInt8
+   * @{
+   */
+  std::vector<int8_t>
+  GetPixelsAsInt8(const std::vector<uint32_t> & indices) const;
+  std::vector<uint8_t>
+  GetPixelsAsUInt8(const std::vector<uint32_t> & indices) const;
+  std::vector<int16_t>
+  GetPixelsAsInt16(const std::vector<uint32_t> & indices) const;
+  std::vector<uint16_t>
+  GetPixelsAsUInt16(const std::vector<uint32_t> & indices) const;
+  std::vector<int32_t>
+  GetPixelsAsInt32(const std::vector<uint32_t> & indices) const;
+  std::vector<uint32_t>
+  GetPixelsAsUInt32(const std::vector<uint32_t> & indices) const;
+  std::vector<int64_t>
+  GetPixelsAsInt64(const std::vector<uint32_t> & indices) const;
+  std::vector<uint64_t>
+  GetPixelsAsUInt64(const std::vector<uint32_t> & indices) const;
+  std::vector<float>
+  GetPixelsAsFloat(const std::vector<uint32_t> & indices) const;
+  std::vector<double>
+  GetPixelsAsDouble(const std::vector<uint32_t> & indices) const;
+  /** @} */
+
+  /** \brief Set the values of many pixels with a single call
+   *
+   * The indices are provided as a flat array of length n*GetDimension() with the same layout as the GetPixelsAs
+   * methods. The values array must contain the same number of values per pixel as would be returned by the
+   * corresponding GetPixelsAs method. The image is made unique only once per call.
+   *
+   * If the same index occurs multiple times, the last value is set. An exception is thrown if any index is out of
+   * bounds, in which case no pixel values are modified.
+   *
+   * \sa Image::GetPixelsAsInt8
+   * @{
+   */
+  void
+  SetPixelsAsInt8(const std::vector<uint32_t> & indices, const std::vector<int8_t> & values);
+  void
+  SetPixelsAsUInt8(const std::vector<uint32_t> & indices, const std::vector<uint8_t> & values);
+  void
+  SetPixelsAsInt16(const std::vector<uint32_t> & indices, const std::vector<int16_t> & values);
+  void
+  SetPixelsAsUInt16(const std::vector<uint32_t> & indices, const std::vector<uint16_t> & values);
+  void
+  SetPixelsAsInt32(const std::vector<uint32_t> & indices, const std::vector<int32_t> & values);
+  void
+  SetPixelsAsUInt32(const std::vector<uint32_t> & indices, const std::vector<uint32_t> & values);
+  void
+  SetPixelsAsInt64(const std::vector<uint32_t> & indices, const std::vector<int64_t> & values);
+  void
+  SetPixelsAsUInt64(const std::vector<uint32_t> & indices, const std::vector<uint64_t> & values);
+  void
+  SetPixelsAsFloat(const std::vector<uint32_t> & indices, const std::vector<float> & values);
+  void
+  SetPixelsAsDouble(const std::vector<uint32_t> & indices, const std::vector<double> & values);
+  /** @} */
+
   /** \brief Get a pointer to the image buffer
    * \warning this is dangerous
    *
@@ -691,6 +807,26 @@ public:
   bool
   IsUnique() const;
 
+#ifndef SWIG
+  /** \brief Set the allocator used for the pixel buffers of images.
+   *
+   * After setting an allocator, the pixel buffers of scalar and
+   * vector images allocated by SimpleITK, including the outputs of
+   * filters, are obtained from the allocator. Buffers already
+   * allocated are released to the allocator they were obtained
+   * from, which is kept alive as long as needed. Setting a nullptr
+   * restores the default allocation.
+   *
+   * \sa PixelBufferAllocator, PooledPixelBufferAllocator
+   * @{
+   */
+  static void
+  SetGlobalPixelBufferAllocator(std::shared_ptr<PixelBufferAllocator> allocator);
+  static std::shared_ptr<PixelBufferAllocator>
+  GetGlobalPixelBufferAllocator();
+  /**@}*/
+#endif
+
   static constexpr double DefaultImageCoordinateTolerance = 1e-6;
   static constexpr double DefaultImageDirectionTolerance = 1e-6;
 
@@ -702,7 +838,10 @@ protected:
    * dispatch to methods instantiated on the image of the pixel ID
    */
   void
-  Allocate(const std::vector<unsigned int> & size, PixelIDValueEnum valueEnum, unsigned int numberOfComponents);
+  Allocate(const std::vector<unsigned int> & size,
+           PixelIDValueEnum                  valueEnum,
+           unsigned int                      numberOfComponents,
+           bool                              initializePixels = true);
 
   /** \brief Allocates images of different types
    *
@@ -710,7 +849,7 @@ protected:
    */
   template <class TImageType>
   void
-  AllocateInternal(const std::vector<unsigned int> & size, unsigned int numberOfComponents);
+  AllocateInternal(const std::vector<unsigned int> & size, unsigned int numberOfComponents, bool initializePixels);
   /**@}*/
 
   /** \brief Internal methods for converting images between vectors and scalars
@@ -742,6 +881,20 @@ private:
 
   Image(std::unique_ptr<PimpleImageBase> pimpleImage);
 
+  /** Methods used by ProcessObject to connect ITK pipelines of
+   * deferred executions.
+   *
+   * The ITK image is returned without updating a deferred execution
+   * which produces it. The pipeline holds the ITK filters producing
+   * this image, which is the un-updated output of the first filter.
+   * @{
+   */
+  const itk::DataObject *
+  GetDeferredITKBase() const;
+  void
+  SetDeferredPipeline(const std::vector<itk::ProcessObject *> & pipeline);
+  /**@}*/
+
 
   template <typename TImageType>
   PimpleImageBase *
@@ -752,6 +905,7 @@ private:
   friend struct AllocateMemberFunctionAddressor;
   friend struct ToVectorAddressor;
   friend struct ToScalarAddressor;
+  friend class ProcessObject;
 
 
   std::unique_ptr<PimpleImageBase> m_PimpleImage;
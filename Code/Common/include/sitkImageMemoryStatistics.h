@@ -0,0 +1,75 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef sitkImageMemoryStatistics_h
+#define sitkImageMemoryStatistics_h
+
+#include "sitkCommon.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace itk::simple
+{
+
+/** \brief Statistics of the memory held by the pixel buffers of images.
+ *
+ * The pixel buffers owned by SimpleITK images are accounted for when
+ * an image is created, including images allocated by constructors,
+ * filter outputs, copies and images read from files. A buffer is
+ * accounted for once, no matter how many images share it, until it
+ * is released. Buffers which are not owned by the image, such as
+ * views of another image and buffers imported without ownership, are
+ * not counted. Label map images do not have a pixel buffer and are
+ * not counted.
+ *
+ * \sa GetImageMemoryStatistics, ResetImageMemoryPeak
+ */
+struct SITKCommon_EXPORT ImageMemoryStatistics
+{
+  /** The number of bytes currently held in pixel buffers. */
+  uint64_t LiveBytes{ 0 };
+
+  /** The maximum of LiveBytes since the start of the process or the
+   * last call to ResetImageMemoryPeak. */
+  uint64_t PeakBytes{ 0 };
+
+  /** The number of pixel buffers currently held. */
+  uint64_t NumberOfLiveBuffers{ 0 };
+
+  /** The total number of pixel buffers accounted for since the start
+   * of the process. */
+  uint64_t NumberOfAllocations{ 0 };
+
+  /** The number of bytes currently held for each pixel type, indexed
+   * by the PixelIDValueEnum. */
+  std::vector<uint64_t> LiveBytesPerPixelID;
+};
+
+/** \brief Get the statistics of memory held by the pixel buffers of
+ * all images in the process. */
+SITKCommon_EXPORT ImageMemoryStatistics
+                  GetImageMemoryStatistics();
+
+/** \brief Set the peak number of bytes held by pixel buffers to the
+ * current number of bytes held. */
+SITKCommon_EXPORT void
+ResetImageMemoryPeak();
+
+} // namespace itk::simple
+
+#endif
@@ -48,16 +48,22 @@ namespace itk::simple::detail
  *  not need to have the calling object specified.
  */
 template <typename TMemberFunctionPointer>
-class MemberFunctionFactory : protected MemberFunctionFactoryBase<TMemberFunctionPointer, std::pair<unsigned int, int>>
+class MemberFunctionFactory
+  : protected MemberFunctionFactoryBase<TMemberFunctionPointer,
+                                        std::pair<unsigned int, int>,
+                                        DenseMemberFunctionTable<TMemberFunctionPointer>>
 {
 
 public:
-  using Superclass = MemberFunctionFactoryBase<TMemberFunctionPointer, std::pair<unsigned int, int>>;
+  using Superclass = MemberFunctionFactoryBase<TMemberFunctionPointer,
+                                               std::pair<unsigned int, int>,
+                                               DenseMemberFunctionTable<TMemberFunctionPointer>>;
   using Self = MemberFunctionFactory;
 
   using MemberFunctionType = TMemberFunctionPointer;
   using ObjectType = typename ::detail::FunctionTraits<MemberFunctionType>::ClassType;
   using FunctionObjectType = typename Superclass::FunctionObjectType;
+  using BoundFunctionObjectType = typename Superclass::BoundFunctionObjectType;
 
   MemberFunctionFactory() = default;
 
@@ -166,9 +172,9 @@ public:
    *
    *  If the requested member function is not registered then an
    *  exception is generated. The returned function object is
-   *  guaranteed to be valid.
+   *  guaranteed to be valid, and is only valid as long as the object.
    */
-  FunctionObjectType
+  BoundFunctionObjectType
   GetMemberFunction(PixelIDValueType pixelID, unsigned int imageDimension, ObjectType * objectPointer) const;
 };
 
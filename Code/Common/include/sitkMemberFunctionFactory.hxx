@@ -97,21 +97,12 @@ bool
 MemberFunctionFactory<TMemberFunctionPointer>::HasMemberFunction(PixelIDValueType pixelID,
                                                                  unsigned int     imageDimension) const noexcept
 {
-  auto key = typename Superclass::KeyType(imageDimension, pixelID);
-  try
-  {
-    // check if function has been set in map
-    return Superclass::m_PFunction.find(key) != Superclass::m_PFunction.end();
-  }
-  // we do not throw exceptions
-  catch (...)
-  {}
-  return false;
+  return Superclass::m_PFunction.Find(imageDimension, pixelID) != nullptr;
 }
 
 
 template <typename TMemberFunctionPointer>
-typename MemberFunctionFactory<TMemberFunctionPointer>::FunctionObjectType
+typename MemberFunctionFactory<TMemberFunctionPointer>::BoundFunctionObjectType
 MemberFunctionFactory<TMemberFunctionPointer>::GetMemberFunction(
   PixelIDValueType                                                     pixelID,
   unsigned int                                                         imageDimension,
@@ -122,13 +113,10 @@ MemberFunctionFactory<TMemberFunctionPointer>::GetMemberFunction(
     sitkExceptionMacro(<< "unexpected error pixelID is out of range " << pixelID << " " << typeid(ObjectType).name());
   }
 
-  auto key = typename Superclass::KeyType(imageDimension, pixelID);
-
-  // check if tr1::function has been set
-  auto ret_pair = Superclass::m_PFunction.find(key);
-  if (ret_pair != Superclass::m_PFunction.end())
+  // check if the member function has been registered
+  if (MemberFunctionType pfunc = Superclass::m_PFunction.Find(imageDimension, pixelID))
   {
-    return Superclass::BindObject(ret_pair->second, objectPointer);
+    return Superclass::BindObject(pfunc, objectPointer);
   }
 
   sitkExceptionMacro(<< "Pixel type: " << GetPixelIDValueAsString(pixelID) << " is not supported in " << imageDimension
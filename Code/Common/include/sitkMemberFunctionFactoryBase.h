@@ -24,6 +24,7 @@
 #include "Ancillary/type_list2.h"
 #include "Ancillary/FunctionTraits.h"
 
+#include <array>
 #include <unordered_map>
 #include <functional>
 #include <tuple>
@@ -77,6 +78,95 @@ public:
 };
 
 
+/** \class BoundMemberFunction
+ * \brief A function object which calls a pointer to member function
+ * on an object.
+ *
+ * Unlike a std::function, it is constructed without an allocation.
+ */
+template <typename TMemberFunctionPointer>
+class BoundMemberFunction;
+
+template <typename TResult, typename TObject, typename... Args>
+class BoundMemberFunction<TResult (TObject::*)(Args...)>
+{
+public:
+  using MemberFunctionType = TResult (TObject::*)(Args...);
+
+  constexpr BoundMemberFunction(MemberFunctionType pfunc, TObject * objectPointer) noexcept
+    : m_PFunction(pfunc)
+    , m_ObjectPointer(objectPointer)
+  {}
+
+  TResult
+  operator()(Args... args) const
+  {
+    return std::invoke(m_PFunction, m_ObjectPointer, std::forward<Args>(args)...);
+  }
+
+private:
+  MemberFunctionType m_PFunction;
+  TObject *          m_ObjectPointer;
+};
+
+
+/** \class DenseMemberFunctionTable
+ * \brief A table of member function pointers indexed by the image
+ * dimension and the pixel ID.
+ *
+ * The lookup is an array access, which is used instead of a hash map
+ * for the dispatch on one image type.
+ */
+template <typename TMemberFunctionPointer>
+class DenseMemberFunctionTable
+{
+public:
+  using KeyType = std::pair<unsigned int, int>;
+
+  static constexpr unsigned int NumberOfDimensions = SITK_MAX_DIMENSION + 1;
+  static constexpr int          NumberOfPixelIDs = typelist2::length<InstantiatedPixelIDTypeList>::value;
+
+  /** Returns the entry for a key in range, to be assigned. */
+  TMemberFunctionPointer &
+  operator[](const KeyType & key) noexcept
+  {
+    return m_Table[key.first * NumberOfPixelIDs + key.second];
+  }
+
+  /** Returns the registered member function, or nullptr if the key is
+   * out of range or not registered. */
+  [[nodiscard]] TMemberFunctionPointer
+  Find(unsigned int imageDimension, int pixelID) const noexcept
+  {
+    if (imageDimension >= NumberOfDimensions || pixelID < 0 || pixelID >= NumberOfPixelIDs)
+    {
+      return nullptr;
+    }
+    return m_Table[imageDimension * NumberOfPixelIDs + pixelID];
+  }
+
+  [[nodiscard]] std::size_t
+  size() const noexcept
+  {
+    std::size_t n = 0;
+    for (const auto & pfunc : m_Table)
+    {
+      n += (pfunc != nullptr);
+    }
+    return n;
+  }
+
+  [[nodiscard]] constexpr std::size_t
+  max_size() const noexcept
+  {
+    return m_Table.size();
+  }
+
+private:
+  std::array<TMemberFunctionPointer, NumberOfDimensions * NumberOfPixelIDs> m_Table{};
+};
+
+
 template <typename TMemberFunctionPointer,
           typename TKey,
           class TContainer = std::unordered_map<TKey, TMemberFunctionPointer, hash<TKey>>>
@@ -96,6 +186,10 @@ public:
    * object */
   using FunctionObjectType = typename ::detail::FunctionTraits<MemberFunctionType>::FunctionObjectType;
 
+  /** the function object returned by GetMemberFunction, which is
+   * convertible to FunctionObjectType */
+  using BoundFunctionObjectType = BoundMemberFunction<MemberFunctionType>;
+
   [[nodiscard]] constexpr double
   GetLoadFactor() const noexcept
   {
@@ -128,13 +222,10 @@ protected:
    *  argument in the member function pointer, and returns a function
    *  object
    */
-  template <typename... Args>
-  static FunctionObjectType
-  BindObject(MemberFunctionResultType (ObjectType ::*pfunc)(Args...), ObjectType * objectPointer)
+  static constexpr BoundFunctionObjectType
+  BindObject(MemberFunctionType pfunc, ObjectType * objectPointer) noexcept
   {
-    return [pfunc, objectPointer](Args... args) -> MemberFunctionResultType {
-      return std::invoke(pfunc, objectPointer, std::forward<Args>(args)...);
-    };
+    return BoundFunctionObjectType(pfunc, objectPointer);
   }
 
   // maps of Keys to pointers to member functions
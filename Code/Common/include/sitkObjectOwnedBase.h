@@ -24,6 +24,7 @@
 
 #include <map>
 #include <functional>
+#include <mutex>
 
 
 namespace itk
@@ -115,6 +116,11 @@ private:
   bool                                                m_OwnedByObjects{ false };
   std::multimap<itk::Object *, std::function<void()>> m_ReferencedObjectsCallbacks;
   std::string                                         m_Name;
+
+  // The objects may be added and removed from multiple threads, as
+  // when a copy of a ProcessObject executing asynchronously holds
+  // the commands of the ProcessObject.
+  mutable std::mutex m_ReferencedObjectsMutex;
 };
 
 } // namespace simple
@@ -0,0 +1,148 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef sitkPixelBufferAllocator_h
+#define sitkPixelBufferAllocator_h
+
+#include "sitkCommon.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <mutex>
+
+namespace itk::simple
+{
+
+/** \class PixelBufferAllocator
+ * \brief An interface to allocate the pixel buffers of images.
+ *
+ * An allocator set with Image::SetGlobalPixelBufferAllocator provides
+ * the pixel buffers of the scalar and vector images allocated by
+ * SimpleITK and by the ITK filters it executes. A buffer is returned
+ * to the allocator with the same number of bytes it was allocated
+ * with.
+ *
+ * The methods may be called concurrently from multiple threads.
+ *
+ * \sa PooledPixelBufferAllocator
+ */
+class SITKCommon_EXPORT PixelBufferAllocator
+{
+public:
+  virtual ~PixelBufferAllocator();
+
+  /** Allocate a buffer of numberOfBytes suitably aligned for any
+   * pixel type. An exception is thrown on failure. */
+  virtual void *
+  Allocate(size_t numberOfBytes) = 0;
+
+  /** Release a buffer obtained from Allocate. */
+  virtual void
+  Deallocate(void * buffer, size_t numberOfBytes) = 0;
+};
+
+
+/** \class PooledPixelBufferAllocator
+ * \brief A pixel buffer allocator which recycles large buffers.
+ *
+ * All buffers are aligned to Alignment bytes. Buffers of at least
+ * the MinimumPooledSize are rounded up to a multiple of the
+ * PoolGranularity. When released they are held in a pool, and are
+ * reused by later allocations rounded to the same size. This avoids
+ * the cost of the system allocator and of the operating system
+ * providing new pages when images of the same size are repeatedly
+ * created and destroyed.
+ *
+ * No more than the MaximumBytesHeld are held in the pool, additional
+ * released buffers are freed.
+ */
+class SITKCommon_EXPORT PooledPixelBufferAllocator : public PixelBufferAllocator
+{
+public:
+  static constexpr size_t Alignment = 64;
+  static constexpr size_t PoolGranularity = 4096;
+
+  PooledPixelBufferAllocator();
+  ~PooledPixelBufferAllocator() override;
+
+  PooledPixelBufferAllocator(const PooledPixelBufferAllocator &) = delete;
+  PooledPixelBufferAllocator &
+  operator=(const PooledPixelBufferAllocator &) = delete;
+
+  void *
+  Allocate(size_t numberOfBytes) override;
+
+  void
+  Deallocate(void * buffer, size_t numberOfBytes) override;
+
+  /** Buffers smaller than this number of bytes are not pooled. The
+   * default is 1 MiB. */
+  void
+  SetMinimumPooledSize(size_t numberOfBytes);
+  size_t
+  GetMinimumPooledSize() const;
+
+  /** The maximum number of bytes held in released buffers. The
+   * default is 1 GiB. */
+  void
+  SetMaximumBytesHeld(size_t numberOfBytes);
+  size_t
+  GetMaximumBytesHeld() const;
+
+  /** The number of pooled size allocations which reused a held
+   * buffer. */
+  uint64_t
+  GetNumberOfHits() const;
+
+  /** The number of pooled size allocations which required a new
+   * buffer. */
+  uint64_t
+  GetNumberOfMisses() const;
+
+  /** The number of bytes in the buffers currently held. */
+  size_t
+  GetBytesHeld() const;
+
+  /** The number of buffers currently held. */
+  size_t
+  GetNumberOfBuffersHeld() const;
+
+  /** Free all buffers held by the pool. */
+  void
+  ReleaseHeldBuffers();
+
+private:
+  size_t
+  GetSizeClass(size_t numberOfBytes) const;
+
+  void
+  TrimToMaximumBytesHeld();
+
+  mutable std::mutex            m_Mutex;
+  std::multimap<size_t, void *> m_HeldBuffers;
+
+  size_t   m_MinimumPooledSize{ size_t(1) << 20 };
+  size_t   m_MaximumBytesHeld{ size_t(1) << 30 };
+  size_t   m_BytesHeld{ 0 };
+  uint64_t m_NumberOfHits{ 0 };
+  uint64_t m_NumberOfMisses{ 0 };
+};
+
+} // namespace itk::simple
+
+#endif
@@ -193,16 +193,73 @@ using AllPixelIDTypeList =
   typelist2::append<BasicPixelIDTypeList, ComplexPixelIDTypeList, VectorPixelIDTypeList, LabelPixelIDTypeList>::type;
 
 
+/** List of the pixel component types selected by the
+ * SimpleITK_PIXEL_TYPES build profile.
+ *
+ * The uint8, uint32, float and double component types are always
+ * included as they are the fixed output types of many filters, the
+ * types of masks, label images, displacement fields and the
+ * registration framework. Without a profile all the component types
+ * are included.
+ */
+using ProfilePixelComponentTypeList = typelist2::typelist<
+#ifdef SITK_PIXEL_TYPE_INT8
+  int8_t,
+#endif
+  uint8_t,
+#ifdef SITK_PIXEL_TYPE_INT16
+  int16_t,
+#endif
+#ifdef SITK_PIXEL_TYPE_UINT16
+  uint16_t,
+#endif
+#ifdef SITK_PIXEL_TYPE_INT32
+  int32_t,
+#endif
+  uint32_t,
+#ifdef SITK_PIXEL_TYPE_INT64
+  int64_t,
+#endif
+#ifdef SITK_PIXEL_TYPE_UINT64
+  uint64_t,
+#endif
+  float,
+  double>;
+
+/** A meta-programming predicate to query if the component type of a
+ * PixelID is in the build profile.
+ *
+ * \sa ProfilePixelComponentTypeList
+ * @{ */
+template <typename TPixelIDType>
+struct IsProfilePixelID;
+template <template <typename> class TPixelIDType, typename TComponentType>
+struct IsProfilePixelID<TPixelIDType<TComponentType>>
+  : typelist2::has_type<ProfilePixelComponentTypeList, TComponentType>
+{};
+template <typename TComponentType>
+struct IsProfilePixelID<BasicPixelID<std::complex<TComponentType>>>
+  : typelist2::has_type<ProfilePixelComponentTypeList, TComponentType>
+{};
+/**@}*/
+
 /** List of pixel ids which are instantiated for use in SimpleITK
  *
  *  this include image of itk::Image,itk::VectorImage, and
  *  itk::LabelMap types.
  *
+ * Pixel ids with a component type not selected by the
+ * SimpleITK_PIXEL_TYPES build profile are removed. As all the member
+ * function factories only register instantiated pixel ids, this
+ * consistently prunes the BasicFilters, IO and Registration
+ * libraries.
+ *
  * \sa BasicPixelID
  * \sa VectorPixelID
  * \sa LabelPixelID
+ * \sa IsProfilePixelID
  */
-using InstantiatedPixelIDTypeList = AllPixelIDTypeList;
+using InstantiatedPixelIDTypeList = typelist2::filter<AllPixelIDTypeList, IsProfilePixelID>::type;
 
 } // namespace itk::simple
 #endif // _sitkPixelIDTypeLists_h
@@ -22,11 +22,18 @@
 #include "sitkNonCopyable.h"
 #include "sitkTemplateFunctions.h"
 #include "sitkEvent.h"
+#include "sitkExecutionStatistics.h"
 #include "sitkImage.h"
 #include "sitkImageConvert.h"
 
+#include <atomic>
+#include <functional>
+#include <future>
 #include <iostream>
 #include <list>
+#include <memory>
+#include <type_traits>
+#include <vector>
 
 namespace itk
 {
@@ -114,6 +121,51 @@ public:
   SetGlobalDefaultDebug(bool debugFlag);
   /**@}*/
 
+  /** Turn deferred execution on/off.
+   *
+   * When enabled, Execute connects the ITK filter to the ITK filters
+   * of deferred input images and returns an image whose pixels are
+   * computed when the image is first accessed. A chain of deferred
+   * filters is updated as a single ITK pipeline, and the data of the
+   * intermediate images is released after it is used, so only the
+   * final image is kept in memory. An intermediate image which is
+   * accessed after its data was released is computed again.
+   *
+   * Commands, execution statistics and the execution trace are not
+   * available for deferred executions, and errors of the ITK filter
+   * are reported when the image is accessed. Filters with
+   * measurements or custom input handling are always executed
+   * immediately.
+   *
+   * Disabled by default.
+   * @{
+   */
+  virtual void
+  DeferredExecutionOn();
+  virtual void
+  DeferredExecutionOff();
+  virtual bool
+  GetDeferredExecution() const;
+  virtual void
+  SetDeferredExecution(bool deferredExecution);
+  /**@}*/
+
+  /** Turn the default deferred execution value on/off.
+   *
+   * This is the initial value used for new classes and procedural
+   * methods.
+   * @{
+   */
+  static void
+  GlobalDefaultDeferredExecutionOn();
+  static void
+  GlobalDefaultDeferredExecutionOff();
+  static bool
+  GetGlobalDefaultDeferredExecution();
+  static void
+  SetGlobalDefaultDeferredExecution(bool deferredExecution);
+  /**@}*/
+
   /** Manage warnings produced by ITK.
    *
    * Enabled by default, this parameter may enable printing
@@ -240,6 +292,26 @@ public:
   GetNumberOfWorkUnits() const;
   /**@}*/
 
+  /** The output is requested to be updated in this number of
+   * divisions.
+   *
+   * When greater than one, filters which produce a division of
+   * their output from divisions of their image inputs update the
+   * output one division at a time, and the ImageFileWriter writes
+   * the image in divisions when the ImageIO supports streamed
+   * writing. Combined with deferred execution of the inputs, only
+   * divisions of the intermediate images are kept in memory. Other
+   * filters update the whole output at once.
+   *
+   * The default is 1.
+   * @{
+   */
+  virtual void
+  SetNumberOfStreamDivisions(unsigned int n);
+  virtual unsigned int
+  GetNumberOfStreamDivisions() const;
+  /**@}*/
+
 
   /** \brief Add a Command Object to observer the event.
    *
@@ -318,11 +390,76 @@ public:
    * content may be only partially updated, uninitialized or the a
    * of size zero.
    *
-   * If there is no active process the method has no effect.
+   * The abort is also forwarded to the ExecuteAsync executions of
+   * this object which are pending or running.
+   *
+   * If there is no active process or asynchronous execution the
+   * method has no effect.
    */
   virtual void
   Abort();
 
+  /** \brief Set/Get the maximum wall time in seconds of an execution.
+   *
+   * When the time from the start of Execute exceeds the timeout, the
+   * active process is aborted from a watchdog thread, as if Abort
+   * was called, and a TimeoutException with the progress and the
+   * elapsed time is thrown out of Execute after the ITK process
+   * returned. Filters which do not check for abort run to completion
+   * before the exception is thrown. The ImageRegistrationMethod is
+   * stopped at the next optimizer iteration.
+   *
+   * Deferred executions are not timed. A value of zero, the
+   * default, disables the timeout.
+   * @{
+   */
+  virtual void
+  SetExecutionTimeout(double seconds);
+  virtual double
+  GetExecutionTimeout() const;
+  /**@}*/
+
+  /** \brief Measurements of the last execution.
+   *
+   * The wall time, processor time, threading and pixel buffer sizes
+   * of the internal ITK process are measured for each execution. The
+   * measurements are updated when the process completes, if the
+   * execution fails the previous measurements are kept.
+   *
+   * \sa ExecutionStatistics
+   */
+  virtual ExecutionStatistics
+  GetLastExecutionStatistics() const;
+
+  /** \brief Measurements of all executions in the process,
+   * aggregated by the name of the ProcessObject.
+   *
+   * The summaries are sorted by decreasing total wall time, so the
+   * ProcessObjects which dominate the execution time are first.
+   * @{
+   */
+  static std::vector<ExecutionStatisticsSummary>
+  GetGlobalExecutionStatistics();
+  static void
+  ResetGlobalExecutionStatistics();
+  /**@}*/
+
+#ifndef SWIG
+  /** \brief Set/Get the maximum number of ExecuteAsync tasks run
+   * concurrently.
+   *
+   * The ExecuteAsync methods of all filters share one executor, tasks
+   * in excess of this number are queued. Each task may also use
+   * multiple threads as set by SetNumberOfThreads. The default is 2.
+   * @{
+   */
+  static void
+  SetGlobalAsyncConcurrency(unsigned int n);
+  static unsigned int
+  GetGlobalAsyncConcurrency();
+  /**@}*/
+#endif
+
 protected:
 #ifndef SWIG
 
@@ -352,6 +489,11 @@ protected:
   virtual void
   PreUpdate(itk::ProcessObject * p);
 
+  // Prepare an ITK filter for a deferred execution, and set the
+  // pipeline of its output image.
+  virtual void
+  PreUpdateDeferred(itk::ProcessObject * p, Image & output);
+
   // overridable method to add a command, the return value is
   // placed in the m_ITKTag of the EventCommand object.
   virtual unsigned long
@@ -374,6 +516,95 @@ protected:
   virtual void
   OnActiveProcessDelete();
 
+  // Returns true and records it if the timeout of the active
+  // execution expired, or the watchdog aborted it.
+  bool
+  IsExecutionTimeoutExpired();
+
+  // Throws a TimeoutException if the timeout of the active execution
+  // expired, or the watchdog aborted it.
+  void
+  CheckExecutionTimeout();
+
+  // Update the ITK process after PreUpdate. When the execution timed
+  // out, a TimeoutException is thrown after the ITK process returned
+  // or was aborted, instead of the ITK ProcessAborted exception.
+  void
+  UpdateWithTimeout(itk::ProcessObject * p);
+
+  // Run a function on the shared executor of ExecuteAsync. The
+  // result or exception of the function is returned in the future.
+  template <typename TFunction>
+  static std::future<std::invoke_result_t<TFunction>>
+  ExecuteAsyncTask(TFunction func)
+  {
+    using ResultType = std::invoke_result_t<TFunction>;
+    auto task = std::make_shared<std::packaged_task<ResultType()>>(std::move(func));
+    std::future<ResultType> future = task->get_future();
+    EnqueueAsyncTask([task]() { (*task)(); });
+    return future;
+  }
+
+  static void
+  EnqueueAsyncTask(std::function<void()> task);
+
+  // The asynchronous executions of copies of a process object, and
+  // the process object while it exists.
+  struct AsyncExecutionState;
+
+  // Prepare a copy of this object for an asynchronous execution. The
+  // commands of this object are added to the copy, and Abort of this
+  // object is forwarded to the copy until it completed. The returned
+  // state is passed to CompleteAsyncExecution.
+  std::shared_ptr<AsyncExecutionState>
+  PrepareAsyncExecution(const std::shared_ptr<ProcessObject> & copy);
+
+  // Called in the task when the execution of the copy completed, the
+  // update function is called with the process object of the copy if
+  // it still exists.
+  static void
+  CompleteAsyncExecution(const std::shared_ptr<AsyncExecutionState> & state,
+                         const ProcessObject *                        copy,
+                         const std::function<void(ProcessObject &)> & update = nullptr);
+
+  // Stop updating this object when its asynchronous executions
+  // complete. Called by the destructor of a derived class, whose
+  // members are updated, before they are destroyed.
+  void
+  DetachAsyncExecutions();
+
+  // Run a task for each index of a batch on the ITK thread pool,
+  // with up to numberOfThreads, or the number of threads of this
+  // process object when zero. The first exception of a task is
+  // thrown after all tasks completed. When an ITK filter is provided
+  // its progress is reported, the remaining tasks are skipped when it
+  // is aborted, and as with UpdateWithTimeout a TimeoutException is
+  // thrown when the execution timed out.
+  void
+  ParallelizeBatch(size_t                              numberOfTasks,
+                   const std::function<void(size_t)> & task,
+                   unsigned int                        numberOfThreads = 0,
+                   itk::ProcessObject *                filter = nullptr);
+
+  // When the result cache is enabled, return the stored result of an
+  // execution with the same parameters and inputs, otherwise run the
+  // execute function and store its result. The parameters function
+  // returns the serialized members which determine the result,
+  // without the threading or execution settings, it is only called
+  // when the cache is enabled. Null inputs are omitted optional
+  // inputs.
+  Image
+  ExecuteWithResultCache(const std::function<std::string()> & parameters,
+                         const std::vector<const Image *> &   inputs,
+                         const std::function<Image()> &       execute);
+
+  // callbacks on the start and end of the active process to
+  // measure the execution
+  virtual void
+  OnActiveProcessStart();
+  virtual void
+  OnActiveProcessEnd();
+
   friend class itk::simple::Command;
   // method call by command when it's deleted, maintains internal
   // references between command and process objects.
@@ -398,6 +629,25 @@ protected:
     return itkImage;
   }
 
+  // Get the ITK image of an image without updating a deferred
+  // execution which produces it, to connect it as an input of an ITK
+  // filter which is not accessed before it is updated.
+  template <class TImageType>
+  static typename TImageType::ConstPointer
+  CastImageToITKDeferred(const Image & img)
+  {
+    typename TImageType::ConstPointer itkImage = dynamic_cast<const TImageType *>(img.GetDeferredITKBase());
+
+    if (itkImage.IsNull())
+    {
+      sitkExceptionMacro("Failure to convert SimpleITK image of dimension: "
+                         << img.GetDimension() << " and pixel type: \"" << img.GetPixelIDTypeAsString()
+                         << "\" to ITK image of dimension: " << TImageType::GetImageDimension() << " and pixel type: \""
+                         << GetPixelIDValueAsString(ImageTypeToPixelIDValue<TImageType>::Result) << "\"!")
+    }
+    return itkImage;
+  }
+
   template <class TImageType>
   static Image
   CastITKToImage(TImageType * img)
@@ -405,6 +655,18 @@ protected:
     return Image(img);
   }
 
+  // Return the output of an ITK filter, which has not been updated,
+  // as the image of a deferred execution. The image holds the filter
+  // and the filters of deferred inputs until it is accessed.
+  template <class TImageType>
+  Image
+  CastITKToDeferredImage(itk::ProcessObject * p, TImageType * img)
+  {
+    Image image(img);
+    this->PreUpdateDeferred(p, image);
+    return image;
+  }
+
 #ifndef SWIG
   template <class TPixelType,
             unsigned int VImageDimension,
@@ -470,10 +732,17 @@ private:
   void
   RemoveObserverFromActiveProcessObject(EventCommand & e);
 
+  // Throws the TimeoutException of the active execution.
+  void
+  ThrowExecutionTimeout();
+
   bool m_Debug;
 
+  bool m_DeferredExecution;
+
   unsigned int m_NumberOfThreads;
   unsigned int m_NumberOfWorkUnits;
+  unsigned int m_NumberOfStreamDivisions;
 
   std::list<EventCommand> m_Commands;
 
@@ -481,6 +750,27 @@ private:
 
   //
   float m_ProgressMeasurement;
+
+  ExecutionStatistics m_LastExecutionStatistics;
+
+  // measurements of the active process, and the times and input
+  // pixel buffers recorded at the stages of the execution
+  ExecutionStatistics       m_ActiveExecutionStatistics;
+  double                    m_ExecutionPreUpdateTime{ 0.0 };
+  double                    m_ExecutionStartWallTime{ 0.0 };
+  double                    m_ExecutionStartCPUTime{ 0.0 };
+  double                    m_ExecutionEndWallTime{ 0.0 };
+  std::vector<const void *> m_ExecutionInputBuffers;
+
+  // the timeout and the state of the watchdog of the active process
+  double            m_ExecutionTimeout{ 0.0 };
+  std::atomic<bool> m_ExecutionTimedOut{ false };
+
+  // the asynchronous executions of copies of this object, and for a
+  // copy an abort forwarded before its process was active
+  std::shared_ptr<AsyncExecutionState> m_AsyncExecutionState;
+  bool                                 m_AsyncExecutionCopy{ false };
+  std::atomic<bool>                    m_AsyncAbortRequested{ false };
 };
 
 
@@ -0,0 +1,106 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef sitkResultCache_h
+#define sitkResultCache_h
+
+#include "sitkCommon.h"
+#include "sitkPathType.h"
+
+#include <cstdint>
+
+namespace itk::simple
+{
+
+/** \brief Statistics of the cache of filter results.
+ *
+ * \sa SetResultCacheMaximumBytes, GetResultCacheStatistics
+ */
+struct SITKCommon_EXPORT ResultCacheStatistics
+{
+  /** The number of executions whose result was found in memory. */
+  uint64_t NumberOfHits{ 0 };
+
+  /** The number of executions whose result was read from the cache
+   * directory. */
+  uint64_t NumberOfDiskHits{ 0 };
+
+  /** The number of cacheable executions whose result was not found. */
+  uint64_t NumberOfMisses{ 0 };
+
+  /** The number of results currently held in memory. */
+  uint64_t NumberOfImages{ 0 };
+
+  /** The number of bytes of pixel buffers currently held in memory. */
+  uint64_t Bytes{ 0 };
+};
+
+/** \brief Set the maximum number of bytes of results kept in memory
+ * by the cache of filter results.
+ *
+ * When the result cache is enabled, the output of an image filter is
+ * stored with a key computed from the SHA1 hashes of the input images,
+ * which include the meta-data and pixel buffer, the parameters of the
+ * filter written at full precision, and the SimpleITK and ITK
+ * versions. The number of threads, commands and other execution
+ * settings are not part of the key. When a filter is executed again
+ * with the same parameters on inputs with the same content, a shallow
+ * copy of the stored output is returned without running the ITK
+ * filter. The copy on write policy of the Image ensures the stored
+ * result is not modified.
+ *
+ * The results are evicted in least recently used order when the
+ * maximum is exceeded. A value of 0, the default, disables the memory
+ * cache.
+ *
+ * Filters with measurements, random number seeds or inputs other than
+ * images are not cached, nor are label map images.
+ *
+ * \sa SetResultCacheDirectory
+ */
+SITKCommon_EXPORT void
+SetResultCacheMaximumBytes(uint64_t numberOfBytes);
+SITKCommon_EXPORT uint64_t
+GetResultCacheMaximumBytes();
+
+/** \brief Set a directory where the results of filters are also
+ * stored.
+ *
+ * When the directory is set, results are written to a file named by
+ * the cache key, and are read from the directory when not found in
+ * memory. The directory can be shared between processes. The files
+ * are not removed, an empty path disables the disk store, which is
+ * the default.
+ */
+SITKCommon_EXPORT void
+SetResultCacheDirectory(const PathType & directory);
+SITKCommon_EXPORT PathType
+GetResultCacheDirectory();
+
+/** \brief Remove all results held in memory by the result cache, and
+ * reset the statistics. The files in the cache directory are not
+ * removed. */
+SITKCommon_EXPORT void
+ClearResultCache();
+
+/** \brief Get the statistics of the cache of filter results. */
+SITKCommon_EXPORT ResultCacheStatistics
+                  GetResultCacheStatistics();
+
+} // namespace itk::simple
+
+#endif
@@ -22,6 +22,7 @@
 #include "sitkCommon.h"
 #include "sitkExceptionObject.h"
 
+#include <cassert>
 #include <vector>
 #include <ostream>
 #include <iterator>
@@ -181,6 +182,43 @@ sitkITKImageRegionToSTL(const ImageRegion<VImageDimension> & in)
 }
 
 
+/** \brief Make the index of the largest possible region of an ITK
+ * image zero, as SimpleITK must use a zero based index.
+ *
+ * The origin is moved to the physical location of the original
+ * index, and the buffered region is set to match.
+ */
+template <class TImageType>
+void SITKCommon_HIDDEN
+FixNonZeroIndex(TImageType * img)
+{
+  assert(img != nullptr);
+
+  typename TImageType::RegionType r = img->GetLargestPossibleRegion();
+  typename TImageType::IndexType  idx = r.GetIndex();
+
+  for (unsigned int i = 0; i < TImageType::ImageDimension; ++i)
+  {
+
+    if (idx[i] != 0)
+    {
+      // if any of the indicies are non-zero, then just fix it
+      typename TImageType::PointType o;
+      img->TransformIndexToPhysicalPoint(idx, o);
+      img->SetOrigin(o);
+
+      idx.Fill(0);
+      r.SetIndex(idx);
+
+      // Need to set the buffered region to match largest
+      img->SetRegions(r);
+
+      return;
+    }
+  }
+}
+
+
 /* \brief Convert to an itk::Matrix type, where the vector is in row
  * major form. If the vector is of 0-size then an identity matrix will
  * be constructed.
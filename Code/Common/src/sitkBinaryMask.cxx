@@ -0,0 +1,369 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#include "sitkBinaryMask.h"
+#include "sitkExceptionObject.h"
+#include "sitkTemplateFunctions.h"
+
+#include <algorithm>
+#include <bitset>
+#include <functional>
+#include <sstream>
+
+namespace itk::simple
+{
+
+namespace
+{
+
+constexpr unsigned int BitsPerWord = 64;
+
+uint64_t
+NumberOfWords(uint64_t numberOfPixels)
+{
+  return (numberOfPixels + BitsPerWord - 1) / BitsPerWord;
+}
+
+template <typename TPixelType>
+void
+PackBuffer(const TPixelType * buffer, uint64_t numberOfPixels, std::vector<BinaryMask::WordType> & words)
+{
+  for (uint64_t w = 0; w < words.size(); ++w)
+  {
+    const uint64_t       begin = w * BitsPerWord;
+    const uint64_t       end = std::min(numberOfPixels, begin + BitsPerWord);
+    BinaryMask::WordType word = 0;
+    for (uint64_t i = begin; i < end; ++i)
+    {
+      word |= static_cast<BinaryMask::WordType>(buffer[i] != 0) << (i - begin);
+    }
+    words[w] = word;
+  }
+}
+
+} // namespace
+
+
+BinaryMask::BinaryMask() = default;
+
+BinaryMask::BinaryMask(const std::vector<unsigned int> & size)
+  : m_Size(size)
+  , m_Origin(size.size(), 0.0)
+  , m_Spacing(size.size(), 1.0)
+  , m_Direction(size.size() * size.size(), 0.0)
+{
+  if (size.size() < 2 || size.size() > SITK_MAX_DIMENSION)
+  {
+    sitkExceptionMacro(<< "Unsupported number of dimensions specified by size: " << size << "!\n"
+                       << "The maximum supported Image dimension is " << SITK_MAX_DIMENSION << ".");
+  }
+
+  for (unsigned int d = 0; d < size.size(); ++d)
+  {
+    m_Direction[d * size.size() + d] = 1.0;
+  }
+
+  m_Words.resize(NumberOfWords(this->GetNumberOfPixels()), 0);
+}
+
+BinaryMask::BinaryMask(const Image & image)
+  : m_Size(image.GetSize())
+  , m_Origin(image.GetOrigin())
+  , m_Spacing(image.GetSpacing())
+  , m_Direction(image.GetDirection())
+{
+  const uint64_t numberOfPixels = image.GetNumberOfPixels();
+  m_Words.resize(NumberOfWords(numberOfPixels));
+
+  // Not all pixel types may be instantiated, so the values are
+  // compared rather than used as case labels.
+  const PixelIDValueEnum pixelID = image.GetPixelID();
+  if (pixelID == sitkUInt8)
+  {
+    PackBuffer(image.GetBufferAsUInt8(), numberOfPixels, m_Words);
+  }
+  else if (pixelID == sitkInt8)
+  {
+    PackBuffer(image.GetBufferAsInt8(), numberOfPixels, m_Words);
+  }
+  else if (pixelID == sitkUInt16)
+  {
+    PackBuffer(image.GetBufferAsUInt16(), numberOfPixels, m_Words);
+  }
+  else if (pixelID == sitkInt16)
+  {
+    PackBuffer(image.GetBufferAsInt16(), numberOfPixels, m_Words);
+  }
+  else if (pixelID == sitkUInt32)
+  {
+    PackBuffer(image.GetBufferAsUInt32(), numberOfPixels, m_Words);
+  }
+  else if (pixelID == sitkInt32)
+  {
+    PackBuffer(image.GetBufferAsInt32(), numberOfPixels, m_Words);
+  }
+  else if (pixelID == sitkUInt64)
+  {
+    PackBuffer(image.GetBufferAsUInt64(), numberOfPixels, m_Words);
+  }
+  else if (pixelID == sitkInt64)
+  {
+    PackBuffer(image.GetBufferAsInt64(), numberOfPixels, m_Words);
+  }
+  else
+  {
+    sitkExceptionMacro(<< "A BinaryMask can not be created from an image of pixel type: "
+                       << GetPixelIDValueAsString(pixelID) << ". A scalar integer pixel type is required.");
+  }
+}
+
+BinaryMask::BinaryMask(const BinaryMask &) = default;
+BinaryMask::BinaryMask(BinaryMask &&) noexcept = default;
+BinaryMask &
+BinaryMask::operator=(const BinaryMask &) = default;
+BinaryMask &
+BinaryMask::operator=(BinaryMask &&) noexcept = default;
+BinaryMask::~BinaryMask() = default;
+
+
+Image
+BinaryMask::ToImage() const
+{
+  // every pixel is written below
+  Image image = Image::CreateUninitialized(m_Size, sitkUInt8);
+  image.SetOrigin(m_Origin);
+  image.SetSpacing(m_Spacing);
+  image.SetDirection(m_Direction);
+
+  uint8_t *      buffer = image.GetBufferAsUInt8();
+  const uint64_t numberOfPixels = this->GetNumberOfPixels();
+  for (uint64_t i = 0; i < numberOfPixels; ++i)
+  {
+    buffer[i] = static_cast<uint8_t>((m_Words[i / BitsPerWord] >> (i % BitsPerWord)) & 1u);
+  }
+  return image;
+}
+
+
+unsigned int
+BinaryMask::GetDimension() const
+{
+  return static_cast<unsigned int>(m_Size.size());
+}
+
+std::vector<unsigned int>
+BinaryMask::GetSize() const
+{
+  return m_Size;
+}
+
+uint64_t
+BinaryMask::GetNumberOfPixels() const
+{
+  if (m_Size.empty())
+  {
+    return 0;
+  }
+  uint64_t numberOfPixels = 1;
+  for (const auto s : m_Size)
+  {
+    numberOfPixels *= s;
+  }
+  return numberOfPixels;
+}
+
+std::vector<double>
+BinaryMask::GetOrigin() const
+{
+  return m_Origin;
+}
+
+void
+BinaryMask::SetOrigin(const std::vector<double> & origin)
+{
+  if (origin.size() != m_Size.size())
+  {
+    sitkExceptionMacro(<< "Expected origin of dimension " << m_Size.size() << " but got " << origin << ".");
+  }
+  m_Origin = origin;
+}
+
+std::vector<double>
+BinaryMask::GetSpacing() const
+{
+  return m_Spacing;
+}
+
+void
+BinaryMask::SetSpacing(const std::vector<double> & spacing)
+{
+  if (spacing.size() != m_Size.size())
+  {
+    sitkExceptionMacro(<< "Expected spacing of dimension " << m_Size.size() << " but got " << spacing << ".");
+  }
+  m_Spacing = spacing;
+}
+
+std::vector<double>
+BinaryMask::GetDirection() const
+{
+  return m_Direction;
+}
+
+void
+BinaryMask::SetDirection(const std::vector<double> & direction)
+{
+  if (direction.size() != m_Size.size() * m_Size.size())
+  {
+    sitkExceptionMacro(<< "Expected direction of " << m_Size.size() * m_Size.size() << " elements but got "
+                       << direction << ".");
+  }
+  m_Direction = direction;
+}
+
+
+bool
+BinaryMask::GetPixel(const std::vector<uint32_t> & idx) const
+{
+  const uint64_t offset = this->ComputeOffset(idx);
+  return ((m_Words[offset / BitsPerWord] >> (offset % BitsPerWord)) & 1u) != 0;
+}
+
+void
+BinaryMask::SetPixel(const std::vector<uint32_t> & idx, bool value)
+{
+  const uint64_t offset = this->ComputeOffset(idx);
+  const WordType bit = WordType(1) << (offset % BitsPerWord);
+  WordType &     word = m_Words[offset / BitsPerWord];
+  word = value ? (word | bit) : (word & ~bit);
+}
+
+void
+BinaryMask::Fill(bool value)
+{
+  std::fill(m_Words.begin(), m_Words.end(), value ? ~WordType(0) : WordType(0));
+  this->ClearTrailingBits();
+}
+
+uint64_t
+BinaryMask::CountOn() const
+{
+  uint64_t count = 0;
+  for (const auto word : m_Words)
+  {
+    count += std::bitset<BitsPerWord>(word).count();
+  }
+  return count;
+}
+
+
+BinaryMask &
+BinaryMask::And(const BinaryMask & other)
+{
+  this->CheckSameSize(other);
+  std::transform(m_Words.begin(), m_Words.end(), other.m_Words.begin(), m_Words.begin(), std::bit_and<WordType>());
+  return *this;
+}
+
+BinaryMask &
+BinaryMask::Or(const BinaryMask & other)
+{
+  this->CheckSameSize(other);
+  std::transform(m_Words.begin(), m_Words.end(), other.m_Words.begin(), m_Words.begin(), std::bit_or<WordType>());
+  return *this;
+}
+
+BinaryMask &
+BinaryMask::Xor(const BinaryMask & other)
+{
+  this->CheckSameSize(other);
+  std::transform(m_Words.begin(), m_Words.end(), other.m_Words.begin(), m_Words.begin(), std::bit_xor<WordType>());
+  return *this;
+}
+
+BinaryMask &
+BinaryMask::Not()
+{
+  std::transform(m_Words.begin(), m_Words.end(), m_Words.begin(), std::bit_not<WordType>());
+  this->ClearTrailingBits();
+  return *this;
+}
+
+
+uint64_t
+BinaryMask::GetNumberOfBytes() const
+{
+  return m_Words.size() * sizeof(WordType);
+}
+
+std::string
+BinaryMask::ToString() const
+{
+  std::ostringstream out;
+  out << "BinaryMask (" << this << ")\n";
+  out << "  Size: " << m_Size << "\n";
+  out << "  Origin: " << m_Origin << "\n";
+  out << "  Spacing: " << m_Spacing << "\n";
+  out << "  Direction: " << m_Direction << "\n";
+  out << "  NumberOfBytes: " << this->GetNumberOfBytes() << "\n";
+  out << "  NumberOfPixelsOn: " << this->CountOn() << "\n";
+  return out.str();
+}
+
+
+void
+BinaryMask::CheckSameSize(const BinaryMask & other) const
+{
+  if (m_Size != other.m_Size)
+  {
+    sitkExceptionMacro(<< "BinaryMask of size " << other.m_Size << " does not match the size " << m_Size << ".");
+  }
+}
+
+uint64_t
+BinaryMask::ComputeOffset(const std::vector<uint32_t> & idx) const
+{
+  if (idx.size() < m_Size.size())
+  {
+    sitkExceptionMacro(<< "Index " << idx << " has fewer dimensions than the BinaryMask of size " << m_Size << ".");
+  }
+
+  uint64_t offset = 0;
+  uint64_t stride = 1;
+  for (unsigned int d = 0; d < m_Size.size(); ++d)
+  {
+    if (idx[d] >= m_Size[d])
+    {
+      sitkExceptionMacro(<< "Index " << idx << " is out of bounds of the BinaryMask of size " << m_Size << ".");
+    }
+    offset += idx[d] * stride;
+    stride *= m_Size[d];
+  }
+  return offset;
+}
+
+void
+BinaryMask::ClearTrailingBits()
+{
+  const uint64_t remainder = this->GetNumberOfPixels() % BitsPerWord;
+  if (!m_Words.empty() && remainder != 0)
+  {
+    m_Words.back() &= (WordType(1) << remainder) - 1;
+  }
+}
+
+} // namespace itk::simple
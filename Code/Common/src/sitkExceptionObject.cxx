@@ -160,4 +160,48 @@ GenericException::GetLine() const
   return 0;
 }
 
+
+TimeoutException::TimeoutException() noexcept = default;
+
+TimeoutException::TimeoutException(const TimeoutException & e) noexcept = default;
+
+TimeoutException::TimeoutException(const std::string & file,
+                                   unsigned int        lineNumber,
+                                   const std::string & desc,
+                                   float               progress,
+                                   double              elapsedTime) noexcept
+  : GenericException(file, lineNumber, desc)
+  , m_Progress(progress)
+  , m_ElapsedTime(elapsedTime)
+{}
+
+TimeoutException::~TimeoutException() noexcept = default;
+
+TimeoutException &
+TimeoutException::operator=(const TimeoutException & orig)
+{
+  GenericException::operator=(orig);
+  this->m_Progress = orig.m_Progress;
+  this->m_ElapsedTime = orig.m_ElapsedTime;
+  return *this;
+}
+
+const char *
+TimeoutException::GetNameOfClass() const
+{
+  return "TimeoutException";
+}
+
+float
+TimeoutException::GetProgress() const
+{
+  return this->m_Progress;
+}
+
+double
+TimeoutException::GetElapsedTime() const
+{
+  return this->m_ElapsedTime;
+}
+
 } // namespace itk::simple
@@ -0,0 +1,243 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#include "sitkExecutionTrace.h"
+#include "sitkExceptionObject.h"
+#include "sitkMacro.h"
+
+#include "itksys/SystemInformation.hxx"
+
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <mutex>
+#include <thread>
+
+namespace itk::simple
+{
+
+namespace
+{
+
+struct ExecutionTraceEvent
+{
+  std::string                                      m_Name;
+  std::string                                      m_Category;
+  double                                           m_StartTime;
+  double                                           m_EndTime;
+  unsigned int                                     m_ThreadNumber;
+  std::vector<std::pair<std::string, std::string>> m_Args;
+};
+
+struct ExecutionTrace
+{
+  std::atomic<bool> m_Enabled{ false };
+
+  std::mutex                              m_Mutex;
+  std::vector<ExecutionTraceEvent>        m_Events;
+  std::map<std::thread::id, unsigned int> m_ThreadNumbers;
+};
+
+ExecutionTrace &
+GetExecutionTrace()
+{
+  // Intentionally leaked so that processes executed during static
+  // destruction can still be traced.
+  static auto * trace = new ExecutionTrace;
+  return *trace;
+}
+
+void
+WriteJSONString(std::ostream & os, const std::string & str)
+{
+  os << '"';
+  for (const char c : str)
+  {
+    switch (c)
+    {
+      case '"':
+        os << "\\\"";
+        break;
+      case '\\':
+        os << "\\\\";
+        break;
+      case '\n':
+        os << "\\n";
+        break;
+      case '\t':
+        os << "\\t";
+        break;
+      default:
+        if (static_cast<unsigned char>(c) < 0x20)
+        {
+          os << "\\u" << std::hex << std::setw(4) << std::setfill('0') << int(c) << std::dec << std::setfill(' ');
+        }
+        else
+        {
+          os << c;
+        }
+    }
+  }
+  os << '"';
+}
+
+} // namespace
+
+
+void
+StartExecutionTrace()
+{
+  GetExecutionTrace().m_Enabled = true;
+}
+
+void
+StopExecutionTrace()
+{
+  GetExecutionTrace().m_Enabled = false;
+}
+
+bool
+IsExecutionTraceEnabled()
+{
+  return GetExecutionTrace().m_Enabled;
+}
+
+void
+ClearExecutionTrace()
+{
+  ExecutionTrace &            trace = GetExecutionTrace();
+  std::lock_guard<std::mutex> lock(trace.m_Mutex);
+  trace.m_Events.clear();
+}
+
+
+void
+WriteExecutionTrace(const PathType & fileName)
+{
+  std::ofstream out(fileName.c_str());
+  if (!out)
+  {
+    sitkExceptionMacro(<< "Unable to open \"" << fileName << "\" for writing the execution trace.");
+  }
+
+  itksys::SystemInformation systemInformation;
+  const long long           pid = systemInformation.GetProcessId();
+
+  ExecutionTrace &            trace = GetExecutionTrace();
+  std::lock_guard<std::mutex> lock(trace.m_Mutex);
+
+  // The times are written in microseconds
+  out << std::fixed << std::setprecision(3);
+  out << "{\"traceEvents\":[";
+  bool first = true;
+  for (const auto & event : trace.m_Events)
+  {
+    out << (first ? "\n" : ",\n");
+    first = false;
+
+    out << "{\"name\":";
+    WriteJSONString(out, event.m_Name);
+    out << ",\"cat\":";
+    WriteJSONString(out, event.m_Category);
+    out << ",\"ph\":\"X\",\"ts\":" << event.m_StartTime * 1e6
+        << ",\"dur\":" << (event.m_EndTime - event.m_StartTime) * 1e6 << ",\"pid\":" << pid
+        << ",\"tid\":" << event.m_ThreadNumber;
+    if (!event.m_Args.empty())
+    {
+      out << ",\"args\":{";
+      for (size_t i = 0; i < event.m_Args.size(); ++i)
+      {
+        out << (i ? "," : "");
+        WriteJSONString(out, event.m_Args[i].first);
+        out << ":";
+        WriteJSONString(out, event.m_Args[i].second);
+      }
+      out << "}";
+    }
+    out << "}";
+  }
+  out << "\n],\"displayTimeUnit\":\"ms\"}\n";
+
+  if (!out)
+  {
+    sitkExceptionMacro(<< "Error writing the execution trace to \"" << fileName << "\".");
+  }
+}
+
+
+double
+GetExecutionTraceTime()
+{
+  return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+
+void
+AddExecutionTraceEvent(const std::string &                                       name,
+                       const std::string &                                       category,
+                       double                                                    startTime,
+                       double                                                    endTime,
+                       const std::vector<std::pair<std::string, std::string>> & args)
+{
+  ExecutionTrace & trace = GetExecutionTrace();
+  if (!trace.m_Enabled)
+  {
+    return;
+  }
+
+  std::lock_guard<std::mutex> lock(trace.m_Mutex);
+
+  // number the threads in the order they are first traced
+  const unsigned int threadNumber =
+    trace.m_ThreadNumbers
+      .emplace(std::this_thread::get_id(), static_cast<unsigned int>(trace.m_ThreadNumbers.size()))
+      .first->second;
+
+  trace.m_Events.push_back(ExecutionTraceEvent{ name, category, startTime, endTime, threadNumber, args });
+}
+
+
+ExecutionTraceScope::ExecutionTraceScope(std::string name, std::string category)
+  : m_Name(std::move(name))
+  , m_Category(std::move(category))
+  , m_StartTime(0.0)
+  , m_Enabled(IsExecutionTraceEnabled())
+{
+  if (m_Enabled)
+  {
+    m_StartTime = GetExecutionTraceTime();
+  }
+}
+
+ExecutionTraceScope::~ExecutionTraceScope()
+{
+  if (m_Enabled)
+  {
+    try
+    {
+      AddExecutionTraceEvent(m_Name, m_Category, m_StartTime, GetExecutionTraceTime());
+    }
+    catch (...)
+    {
+      // the trace is best effort, do not throw from a destructor
+    }
+  }
+}
+
+} // namespace itk::simple
@@ -25,12 +25,81 @@
 #include "sitkPixelIDTypeLists.h"
 #include "sitkConditional.h"
 
+#include <algorithm>
+#include <unordered_map>
 #include <utility>
 
 
 namespace itk::simple
 {
 
+namespace
+{
+
+// Get the mutex of an ITK filter of a deferred pipeline. The registry
+// holds weak references, the mutex is owned by the locks of the images
+// holding the filter. The registry mutex is only held to find the
+// mutex, not while a pipeline is updated. A new filter at the address
+// of a released filter may get a mutex still held by an updated image,
+// which only serializes more updates than needed.
+std::shared_ptr<std::mutex>
+GetDeferredFilterMutex(const itk::ProcessObject * filter)
+{
+  static std::mutex registryMutex;
+  static std::unordered_map<const itk::ProcessObject *, std::weak_ptr<std::mutex>> registry;
+
+  std::lock_guard<std::mutex> lock(registryMutex);
+  std::shared_ptr<std::mutex> mutex = registry[filter].lock();
+  if (!mutex)
+  {
+    // remove the entries of released filters before adding the new one
+    for (auto iter = registry.begin(); iter != registry.end();)
+    {
+      if (iter->second.expired())
+      {
+        iter = registry.erase(iter);
+      }
+      else
+      {
+        ++iter;
+      }
+    }
+    mutex = std::make_shared<std::mutex>();
+    registry[filter] = mutex;
+  }
+  return mutex;
+}
+
+} // namespace
+
+DeferredPipelineLock::DeferredPipelineLock(const std::vector<itk::ProcessObject *> & pipeline)
+{
+  for (const itk::ProcessObject * filter : pipeline)
+  {
+    m_Mutexes.push_back(GetDeferredFilterMutex(filter));
+  }
+  std::sort(m_Mutexes.begin(), m_Mutexes.end());
+  m_Mutexes.erase(std::unique(m_Mutexes.begin(), m_Mutexes.end()), m_Mutexes.end());
+}
+
+void
+DeferredPipelineLock::lock()
+{
+  for (const auto & mutex : m_Mutexes)
+  {
+    mutex->lock();
+  }
+}
+
+void
+DeferredPipelineLock::unlock()
+{
+  for (auto iter = m_Mutexes.rbegin(); iter != m_Mutexes.rend(); ++iter)
+  {
+    (*iter)->unlock();
+  }
+}
+
 Image::~Image() = default;
 
 Image::Image() { Allocate({ 0, 0 }, sitkUInt8, 1); }
@@ -52,7 +121,9 @@ Image::Image(Image && img) noexcept
   : m_PimpleImage(std::move(img.m_PimpleImage))
 {
   img.m_PimpleImage = nullptr;
-  img.Allocate({ 0, 0 }, this->GetPixelID(), this->GetNumberOfComponentsPerPixel());
+  // the number of components is queried from the implementation to
+  // not update a deferred execution
+  img.Allocate({ 0, 0 }, this->GetPixelID(), this->m_PimpleImage->GetNumberOfComponentsPerPixel());
 }
 
 Image &
@@ -84,6 +155,16 @@ Image::Image(const std::vector<unsigned int> & size, PixelIDValueEnum ValueEnum,
   Allocate(size, ValueEnum, numberOfComponents);
 }
 
+Image
+Image::CreateUninitialized(const std::vector<unsigned int> & size,
+                           PixelIDValueEnum                  ValueEnum,
+                           unsigned int                      numberOfComponents)
+{
+  Image img;
+  img.Allocate(size, ValueEnum, numberOfComponents, false);
+  return img;
+}
+
 
 Image
 Image::ProxyForInPlaceOperation()
@@ -114,6 +195,20 @@ Image::GetITKBase()
 
 const itk::DataObject *
 Image::GetITKBase() const
+{
+  if (m_PimpleImage)
+  {
+    this->m_PimpleImage->UpdateDeferredPipeline();
+    return m_PimpleImage->GetDataBase();
+  }
+  else
+  {
+    return nullptr;
+  }
+}
+
+const itk::DataObject *
+Image::GetDeferredITKBase() const
 {
   if (m_PimpleImage)
   {
@@ -125,6 +220,13 @@ Image::GetITKBase() const
   }
 }
 
+void
+Image::SetDeferredPipeline(const std::vector<itk::ProcessObject *> & pipeline)
+{
+  assert(m_PimpleImage);
+  this->m_PimpleImage->SetDeferredPipeline(pipeline);
+}
+
 PixelIDValueType
 Image::GetPixelIDValue() const
 {
@@ -149,6 +251,7 @@ unsigned int
 Image::GetNumberOfComponentsPerPixel() const
 {
   assert(m_PimpleImage);
+  this->m_PimpleImage->UpdateDeferredPipeline();
   return this->m_PimpleImage->GetNumberOfComponentsPerPixel();
 }
 
@@ -156,6 +259,7 @@ uint64_t
 Image::GetNumberOfPixels() const
 {
   assert(m_PimpleImage);
+  this->m_PimpleImage->UpdateDeferredPipeline();
   return this->m_PimpleImage->GetNumberOfPixels();
 }
 
@@ -227,6 +331,7 @@ std::string
 Image::ToString() const
 {
   assert(m_PimpleImage);
+  this->m_PimpleImage->UpdateDeferredPipeline();
   return this->m_PimpleImage->ToString();
 }
 
@@ -239,6 +344,8 @@ Image::IsCongruentImageGeometry(const itk::simple::Image & otherImage,
   {
     return false;
   }
+  this->m_PimpleImage->UpdateDeferredPipeline();
+  otherImage.m_PimpleImage->UpdateDeferredPipeline();
   return this->m_PimpleImage->IsCongruentImageGeometry(
     otherImage.m_PimpleImage.get(), coordinateTolerance, directionTolerance);
 }
@@ -252,6 +359,8 @@ Image::IsSameImageGeometryAs(const itk::simple::Image & otherImage,
   {
     return false;
   }
+  this->m_PimpleImage->UpdateDeferredPipeline();
+  otherImage.m_PimpleImage->UpdateDeferredPipeline();
   return this->m_PimpleImage->IsSameImageGeometryAs(
     otherImage.m_PimpleImage.get(), coordinateTolerance, directionTolerance);
 }
@@ -261,6 +370,7 @@ std::vector<unsigned int>
 Image::GetSize() const
 {
   assert(m_PimpleImage);
+  this->m_PimpleImage->UpdateDeferredPipeline();
   return this->m_PimpleImage->GetSize();
 }
 
@@ -268,6 +378,7 @@ unsigned int
 Image::GetWidth() const
 {
   assert(m_PimpleImage);
+  this->m_PimpleImage->UpdateDeferredPipeline();
   return this->m_PimpleImage->GetWidth();
 }
 
@@ -275,6 +386,7 @@ unsigned int
 Image::GetHeight() const
 {
   assert(m_PimpleImage);
+  this->m_PimpleImage->UpdateDeferredPipeline();
   return this->m_PimpleImage->GetHeight();
 }
 
@@ -282,6 +394,7 @@ unsigned int
 Image::GetDepth() const
 {
   assert(m_PimpleImage);
+  this->m_PimpleImage->UpdateDeferredPipeline();
   return this->m_PimpleImage->GetDepth();
 }
 
@@ -290,6 +403,7 @@ std::vector<double>
 Image::GetOrigin() const
 {
   assert(m_PimpleImage);
+  this->m_PimpleImage->UpdateDeferredPipeline();
   return this->m_PimpleImage->GetOrigin();
 }
 
@@ -307,6 +421,7 @@ std::vector<double>
 Image::GetSpacing() const
 {
   assert(m_PimpleImage);
+  this->m_PimpleImage->UpdateDeferredPipeline();
   return this->m_PimpleImage->GetSpacing();
 }
 
@@ -324,6 +439,7 @@ std::vector<double>
 Image::GetDirection() const
 {
   assert(m_PimpleImage);
+  this->m_PimpleImage->UpdateDeferredPipeline();
   return this->m_PimpleImage->GetDirection();
 }
 
@@ -362,6 +478,7 @@ std::vector<std::string>
 Image::GetMetaDataKeys() const
 {
   assert(m_PimpleImage);
+  this->m_PimpleImage->UpdateDeferredPipeline();
   const itk::MetaDataDictionary & mdd = this->m_PimpleImage->GetDataBase()->GetMetaDataDictionary();
   return mdd.GetKeys();
 }
@@ -370,6 +487,7 @@ bool
 Image::HasMetaDataKey(const std::string & key) const
 {
   assert(m_PimpleImage);
+  this->m_PimpleImage->UpdateDeferredPipeline();
   const itk::MetaDataDictionary & mdd = this->m_PimpleImage->GetDataBase()->GetMetaDataDictionary();
   return mdd.HasKey(key);
 }
@@ -378,6 +496,7 @@ std::string
 Image::GetMetaData(const std::string & key) const
 {
   assert(m_PimpleImage);
+  this->m_PimpleImage->UpdateDeferredPipeline();
   const itk::MetaDataDictionary & mdd = this->m_PimpleImage->GetDataBase()->GetMetaDataDictionary();
   std::string                     value;
   if (ExposeMetaData(mdd, key, value))
@@ -413,6 +532,7 @@ std::vector<int64_t>
 Image::TransformPhysicalPointToIndex(const std::vector<double> & pt) const
 {
   assert(m_PimpleImage);
+  this->m_PimpleImage->UpdateDeferredPipeline();
   return this->m_PimpleImage->TransformPhysicalPointToIndex(pt);
 }
 
@@ -421,6 +541,7 @@ std::vector<double>
 Image::TransformIndexToPhysicalPoint(const std::vector<int64_t> & idx) const
 {
   assert(m_PimpleImage);
+  this->m_PimpleImage->UpdateDeferredPipeline();
   return this->m_PimpleImage->TransformIndexToPhysicalPoint(idx);
 }
 
@@ -429,6 +550,7 @@ std::vector<double>
 Image::TransformPhysicalPointToContinuousIndex(const std::vector<double> & pt) const
 {
   assert(m_PimpleImage);
+  this->m_PimpleImage->UpdateDeferredPipeline();
   return this->m_PimpleImage->TransformPhysicalPointToContinuousIndex(pt);
 }
 // Continuous Index to Physical Point
@@ -436,6 +558,7 @@ std::vector<double>
 Image::TransformContinuousIndexToPhysicalPoint(const std::vector<double> & idx) const
 {
   assert(m_PimpleImage);
+  this->m_PimpleImage->UpdateDeferredPipeline();
   return this->m_PimpleImage->TransformContinuousIndexToPhysicalPoint(idx);
 }
 
@@ -443,20 +566,31 @@ std::vector<double>
 Image::EvaluateAtContinuousIndex(const std::vector<double> & index, InterpolatorEnum interp) const
 {
   assert(m_PimpleImage);
+  this->m_PimpleImage->UpdateDeferredPipeline();
   return this->m_PimpleImage->EvaluateAtContinuousIndex(index, interp);
 }
 std::vector<double>
 Image::EvaluateAtPhysicalPoint(const std::vector<double> & point, InterpolatorEnum interp) const
 {
   assert(m_PimpleImage);
+  this->m_PimpleImage->UpdateDeferredPipeline();
   const std::vector<double> index = this->TransformPhysicalPointToContinuousIndex(point);
   return this->EvaluateAtContinuousIndex(index, interp);
 }
 
+std::vector<double>
+Image::EvaluateAtPhysicalPoints(const std::vector<double> & points, InterpolatorEnum interp) const
+{
+  assert(m_PimpleImage);
+  this->m_PimpleImage->UpdateDeferredPipeline();
+  return this->m_PimpleImage->EvaluateAtPhysicalPoints(points, interp);
+}
+
 int8_t
 Image::GetPixelAsInt8(const std::vector<uint32_t> & idx) const
 {
   assert(m_PimpleImage);
+  this->m_PimpleImage->UpdateDeferredPipeline();
   return this->m_PimpleImage->GetPixelAsInt8(idx);
 }
 
@@ -464,6 +598,7 @@ uint8_t
 Image::GetPixelAsUInt8(const std::vector<uint32_t> & idx) const
 {
   assert(m_PimpleImage);
+  this->m_PimpleImage->UpdateDeferredPipeline();
   return this->m_PimpleImage->GetPixelAsUInt8(idx);
 }
 
@@ -471,6 +606,7 @@ int16_t
 Image::GetPixelAsInt16(const std::vector<uint32_t> & idx) const
 {
   assert(m_PimpleImage);
+  this->m_PimpleImage->UpdateDeferredPipeline();
   return this->m_PimpleImage->GetPixelAsInt16(idx);
 }
 
@@ -478,6 +614,7 @@ uint16_t
 Image::GetPixelAsUInt16(const std::vector<uint32_t> & idx) const
 {
   assert(m_PimpleImage);
+  this->m_PimpleImage->UpdateDeferredPipeline();
   return this->m_PimpleImage->GetPixelAsUInt16(idx);
 }
 
@@ -485,6 +622,7 @@ int32_t
 Image::GetPixelAsInt32(const std::vector<uint32_t> & idx) const
 {
   assert(m_PimpleImage);
+  this->m_PimpleImage->UpdateDeferredPipeline();
   return this->m_PimpleImage->GetPixelAsInt32(idx);
 }
 
@@ -492,6 +630,7 @@ uint32_t
 Image::GetPixelAsUInt32(const std::vector<uint32_t> & idx) const
 {
   assert(m_PimpleImage);
+  this->m_PimpleImage->UpdateDeferredPipeline();
   return this->m_PimpleImage->GetPixelAsUInt32(idx);
 }
 
@@ -499,6 +638,7 @@ int64_t
 Image::GetPixelAsInt64(const std::vector<uint32_t> & idx) const
 {
   assert(m_PimpleImage);
+  this->m_PimpleImage->UpdateDeferredPipeline();
   return this->m_PimpleImage->GetPixelAsInt64(idx);
 }
 
@@ -506,6 +646,7 @@ uint64_t
 Image::GetPixelAsUInt64(const std::vector<uint32_t> & idx) const
 {
   assert(m_PimpleImage);
+  this->m_PimpleImage->UpdateDeferredPipeline();
   return this->m_PimpleImage->GetPixelAsUInt64(idx);
 }
 
@@ -513,6 +654,7 @@ float
 Image::GetPixelAsFloat(const std::vector<uint32_t> & idx) const
 {
   assert(m_PimpleImage);
+  this->m_PimpleImage->UpdateDeferredPipeline();
   return this->m_PimpleImage->GetPixelAsFloat(idx);
 }
 
@@ -520,6 +662,7 @@ double
 Image::GetPixelAsDouble(const std::vector<uint32_t> & idx) const
 {
   assert(m_PimpleImage);
+  this->m_PimpleImage->UpdateDeferredPipeline();
   return this->m_PimpleImage->GetPixelAsDouble(idx);
 }
 
@@ -527,6 +670,7 @@ std::vector<int8_t>
 Image::GetPixelAsVectorInt8(const std::vector<uint32_t> & idx) const
 {
   assert(m_PimpleImage);
+  this->m_PimpleImage->UpdateDeferredPipeline();
   return this->m_PimpleImage->GetPixelAsVectorInt8(idx);
 }
 
@@ -534,6 +678,7 @@ std::vector<uint8_t>
 Image::GetPixelAsVectorUInt8(const std::vector<uint32_t> & idx) const
 {
   assert(m_PimpleImage);
+  this->m_PimpleImage->UpdateDeferredPipeline();
   return this->m_PimpleImage->GetPixelAsVectorUInt8(idx);
 }
 
@@ -541,6 +686,7 @@ std::vector<int16_t>
 Image::GetPixelAsVectorInt16(const std::vector<uint32_t> & idx) const
 {
   assert(m_PimpleImage);
+  this->m_PimpleImage->UpdateDeferredPipeline();
   return this->m_PimpleImage->GetPixelAsVectorInt16(idx);
 }
 
@@ -548,6 +694,7 @@ std::vector<uint16_t>
 Image::GetPixelAsVectorUInt16(const std::vector<uint32_t> & idx) const
 {
   assert(m_PimpleImage);
+  this->m_PimpleImage->UpdateDeferredPipeline();
   return this->m_PimpleImage->GetPixelAsVectorUInt16(idx);
 }
 
@@ -555,6 +702,7 @@ std::vector<int32_t>
 Image::GetPixelAsVectorInt32(const std::vector<uint32_t> & idx) const
 {
   assert(m_PimpleImage);
+  this->m_PimpleImage->UpdateDeferredPipeline();
   return this->m_PimpleImage->GetPixelAsVectorInt32(idx);
 }
 
@@ -562,6 +710,7 @@ std::vector<uint32_t>
 Image::GetPixelAsVectorUInt32(const std::vector<uint32_t> & idx) const
 {
   assert(m_PimpleImage);
+  this->m_PimpleImage->UpdateDeferredPipeline();
   return this->m_PimpleImage->GetPixelAsVectorUInt32(idx);
 }
 
@@ -569,6 +718,7 @@ std::vector<int64_t>
 Image::GetPixelAsVectorInt64(const std::vector<uint32_t> & idx) const
 {
   assert(m_PimpleImage);
+  this->m_PimpleImage->UpdateDeferredPipeline();
   return this->m_PimpleImage->GetPixelAsVectorInt64(idx);
 }
 
@@ -576,6 +726,7 @@ std::vector<uint64_t>
 Image::GetPixelAsVectorUInt64(const std::vector<uint32_t> & idx) const
 {
   assert(m_PimpleImage);
+  this->m_PimpleImage->UpdateDeferredPipeline();
   return this->m_PimpleImage->GetPixelAsVectorUInt64(idx);
 }
 
@@ -583,6 +734,7 @@ std::vector<float>
 Image::GetPixelAsVectorFloat32(const std::vector<uint32_t> & idx) const
 {
   assert(m_PimpleImage);
+  this->m_PimpleImage->UpdateDeferredPipeline();
   return this->m_PimpleImage->GetPixelAsVectorFloat32(idx);
 }
 
@@ -590,6 +742,7 @@ std::vector<double>
 Image::GetPixelAsVectorFloat64(const std::vector<uint32_t> & idx) const
 {
   assert(m_PimpleImage);
+  this->m_PimpleImage->UpdateDeferredPipeline();
   return this->m_PimpleImage->GetPixelAsVectorFloat64(idx);
 }
 
@@ -597,6 +750,7 @@ std::complex<float>
 Image::GetPixelAsComplexFloat32(const std::vector<uint32_t> & idx) const
 {
   assert(m_PimpleImage);
+  this->m_PimpleImage->UpdateDeferredPipeline();
   return this->m_PimpleImage->GetPixelAsComplexFloat32(idx);
 }
 
@@ -604,6 +758,7 @@ std::complex<double>
 Image::GetPixelAsComplexFloat64(const std::vector<uint32_t> & idx) const
 {
   assert(m_PimpleImage);
+  this->m_PimpleImage->UpdateDeferredPipeline();
   return this->m_PimpleImage->GetPixelAsComplexFloat64(idx);
 }
 
@@ -699,6 +854,7 @@ const int8_t *
 Image::GetBufferAsInt8() const
 {
   assert(m_PimpleImage);
+  this->m_PimpleImage->UpdateDeferredPipeline();
   return this->m_PimpleImage->GetBufferAsInt8();
 }
 
@@ -706,6 +862,7 @@ const uint8_t *
 Image::GetBufferAsUInt8() const
 {
   assert(m_PimpleImage);
+  this->m_PimpleImage->UpdateDeferredPipeline();
   return this->m_PimpleImage->GetBufferAsUInt8();
 }
 
@@ -713,6 +870,7 @@ const int16_t *
 Image::GetBufferAsInt16() const
 {
   assert(m_PimpleImage);
+  this->m_PimpleImage->UpdateDeferredPipeline();
   return this->m_PimpleImage->GetBufferAsInt16();
 }
 
@@ -720,6 +878,7 @@ const uint16_t *
 Image::GetBufferAsUInt16() const
 {
   assert(m_PimpleImage);
+  this->m_PimpleImage->UpdateDeferredPipeline();
   return this->m_PimpleImage->GetBufferAsUInt16();
 }
 
@@ -727,6 +886,7 @@ const int32_t *
 Image::GetBufferAsInt32() const
 {
   assert(m_PimpleImage);
+  this->m_PimpleImage->UpdateDeferredPipeline();
   return this->m_PimpleImage->GetBufferAsInt32();
 }
 
@@ -734,6 +894,7 @@ const uint32_t *
 Image::GetBufferAsUInt32() const
 {
   assert(m_PimpleImage);
+  this->m_PimpleImage->UpdateDeferredPipeline();
   return this->m_PimpleImage->GetBufferAsUInt32();
 }
 
@@ -741,6 +902,7 @@ const int64_t *
 Image::GetBufferAsInt64() const
 {
   assert(m_PimpleImage);
+  this->m_PimpleImage->UpdateDeferredPipeline();
   return this->m_PimpleImage->GetBufferAsInt64();
 }
 
@@ -748,6 +910,7 @@ const uint64_t *
 Image::GetBufferAsUInt64() const
 {
   assert(m_PimpleImage);
+  this->m_PimpleImage->UpdateDeferredPipeline();
   return this->m_PimpleImage->GetBufferAsUInt64();
 }
 
@@ -755,6 +918,7 @@ const float *
 Image::GetBufferAsFloat() const
 {
   assert(m_PimpleImage);
+  this->m_PimpleImage->UpdateDeferredPipeline();
   return this->m_PimpleImage->GetBufferAsFloat();
 }
 
@@ -762,6 +926,7 @@ const double *
 Image::GetBufferAsDouble() const
 {
   assert(m_PimpleImage);
+  this->m_PimpleImage->UpdateDeferredPipeline();
   return this->m_PimpleImage->GetBufferAsDouble();
 }
 
@@ -769,6 +934,7 @@ const void *
 Image::GetBufferAsVoid() const
 {
   assert(m_PimpleImage);
+  this->m_PimpleImage->UpdateDeferredPipeline();
   return this->m_PimpleImage->GetBufferAsVoid();
 }
 
@@ -949,10 +1115,172 @@ Image::SetPixelAsComplexFloat64(const std::vector<uint32_t> & idx, const std::co
 }
 
 
+std::vector<int8_t>
+Image::GetPixelsAsInt8(const std::vector<uint32_t> & indices) const
+{
+  assert(m_PimpleImage);
+  this->m_PimpleImage->UpdateDeferredPipeline();
+  return this->m_PimpleImage->GetPixelsAsInt8(indices);
+}
+
+std::vector<uint8_t>
+Image::GetPixelsAsUInt8(const std::vector<uint32_t> & indices) const
+{
+  assert(m_PimpleImage);
+  this->m_PimpleImage->UpdateDeferredPipeline();
+  return this->m_PimpleImage->GetPixelsAsUInt8(indices);
+}
+
+std::vector<int16_t>
+Image::GetPixelsAsInt16(const std::vector<uint32_t> & indices) const
+{
+  assert(m_PimpleImage);
+  this->m_PimpleImage->UpdateDeferredPipeline();
+  return this->m_PimpleImage->GetPixelsAsInt16(indices);
+}
+
+std::vector<uint16_t>
+Image::GetPixelsAsUInt16(const std::vector<uint32_t> & indices) const
+{
+  assert(m_PimpleImage);
+  this->m_PimpleImage->UpdateDeferredPipeline();
+  return this->m_PimpleImage->GetPixelsAsUInt16(indices);
+}
+
+std::vector<int32_t>
+Image::GetPixelsAsInt32(const std::vector<uint32_t> & indices) const
+{
+  assert(m_PimpleImage);
+  this->m_PimpleImage->UpdateDeferredPipeline();
+  return this->m_PimpleImage->GetPixelsAsInt32(indices);
+}
+
+std::vector<uint32_t>
+Image::GetPixelsAsUInt32(const std::vector<uint32_t> & indices) const
+{
+  assert(m_PimpleImage);
+  this->m_PimpleImage->UpdateDeferredPipeline();
+  return this->m_PimpleImage->GetPixelsAsUInt32(indices);
+}
+
+std::vector<int64_t>
+Image::GetPixelsAsInt64(const std::vector<uint32_t> & indices) const
+{
+  assert(m_PimpleImage);
+  this->m_PimpleImage->UpdateDeferredPipeline();
+  return this->m_PimpleImage->GetPixelsAsInt64(indices);
+}
+
+std::vector<uint64_t>
+Image::GetPixelsAsUInt64(const std::vector<uint32_t> & indices) const
+{
+  assert(m_PimpleImage);
+  this->m_PimpleImage->UpdateDeferredPipeline();
+  return this->m_PimpleImage->GetPixelsAsUInt64(indices);
+}
+
+std::vector<float>
+Image::GetPixelsAsFloat(const std::vector<uint32_t> & indices) const
+{
+  assert(m_PimpleImage);
+  this->m_PimpleImage->UpdateDeferredPipeline();
+  return this->m_PimpleImage->GetPixelsAsFloat(indices);
+}
+
+std::vector<double>
+Image::GetPixelsAsDouble(const std::vector<uint32_t> & indices) const
+{
+  assert(m_PimpleImage);
+  this->m_PimpleImage->UpdateDeferredPipeline();
+  return this->m_PimpleImage->GetPixelsAsDouble(indices);
+}
+
+void
+Image::SetPixelsAsInt8(const std::vector<uint32_t> & indices, const std::vector<int8_t> & values)
+{
+  assert(m_PimpleImage);
+  this->MakeUnique();
+  this->m_PimpleImage->SetPixelsAsInt8(indices, values);
+}
+
+void
+Image::SetPixelsAsUInt8(const std::vector<uint32_t> & indices, const std::vector<uint8_t> & values)
+{
+  assert(m_PimpleImage);
+  this->MakeUnique();
+  this->m_PimpleImage->SetPixelsAsUInt8(indices, values);
+}
+
+void
+Image::SetPixelsAsInt16(const std::vector<uint32_t> & indices, const std::vector<int16_t> & values)
+{
+  assert(m_PimpleImage);
+  this->MakeUnique();
+  this->m_PimpleImage->SetPixelsAsInt16(indices, values);
+}
+
+void
+Image::SetPixelsAsUInt16(const std::vector<uint32_t> & indices, const std::vector<uint16_t> & values)
+{
+  assert(m_PimpleImage);
+  this->MakeUnique();
+  this->m_PimpleImage->SetPixelsAsUInt16(indices, values);
+}
+
+void
+Image::SetPixelsAsInt32(const std::vector<uint32_t> & indices, const std::vector<int32_t> & values)
+{
+  assert(m_PimpleImage);
+  this->MakeUnique();
+  this->m_PimpleImage->SetPixelsAsInt32(indices, values);
+}
+
+void
+Image::SetPixelsAsUInt32(const std::vector<uint32_t> & indices, const std::vector<uint32_t> & values)
+{
+  assert(m_PimpleImage);
+  this->MakeUnique();
+  this->m_PimpleImage->SetPixelsAsUInt32(indices, values);
+}
+
+void
+Image::SetPixelsAsInt64(const std::vector<uint32_t> & indices, const std::vector<int64_t> & values)
+{
+  assert(m_PimpleImage);
+  this->MakeUnique();
+  this->m_PimpleImage->SetPixelsAsInt64(indices, values);
+}
+
+void
+Image::SetPixelsAsUInt64(const std::vector<uint32_t> & indices, const std::vector<uint64_t> & values)
+{
+  assert(m_PimpleImage);
+  this->MakeUnique();
+  this->m_PimpleImage->SetPixelsAsUInt64(indices, values);
+}
+
+void
+Image::SetPixelsAsFloat(const std::vector<uint32_t> & indices, const std::vector<float> & values)
+{
+  assert(m_PimpleImage);
+  this->MakeUnique();
+  this->m_PimpleImage->SetPixelsAsFloat(indices, values);
+}
+
+void
+Image::SetPixelsAsDouble(const std::vector<uint32_t> & indices, const std::vector<double> & values)
+{
+  assert(m_PimpleImage);
+  this->MakeUnique();
+  this->m_PimpleImage->SetPixelsAsDouble(indices, values);
+}
+
+
 void
 Image::MakeUnique()
 {
   assert(m_PimpleImage);
+  this->m_PimpleImage->UpdateDeferredPipeline();
   if (this->m_PimpleImage->GetReferenceCountOfImage() > 1)
   {
     this->m_PimpleImage = this->m_PimpleImage->DeepCopy();
@@ -45,7 +45,7 @@ Image::DispatchedInternalInitialization(itk::DataObject * image)
 
 template <class TImageType>
 void
-Image::AllocateInternal(const std::vector<unsigned int> & _size, unsigned int numberOfComponents)
+Image::AllocateInternal(const std::vector<unsigned int> & _size, unsigned int numberOfComponents, bool initializePixels)
 {
 
   typename TImageType::IndexType index;
@@ -67,7 +67,7 @@ Image::AllocateInternal(const std::vector<unsigned int> & _size, unsigned int nu
                                                               << " but did not specify pixelID as a vector type!");
     }
 
-    image->AllocateInitialized();
+    image->Allocate(initializePixels);
   }
   else if constexpr (IsVector<TImageType>::Value)
   {
@@ -76,14 +76,18 @@ Image::AllocateInternal(const std::vector<unsigned int> & _size, unsigned int nu
       numberOfComponents = TImageType::ImageDimension;
     }
 
-    typename TImageType::PixelType zero;
-
-    zero.SetSize(numberOfComponents);
-    zero.Fill(itk::NumericTraits<typename TImageType::PixelType::ValueType>::Zero);
-
     image->SetNumberOfComponentsPerPixel(numberOfComponents);
     image->Allocate();
-    image->FillBuffer(zero);
+
+    if (initializePixels)
+    {
+      typename TImageType::PixelType zero;
+
+      zero.SetSize(numberOfComponents);
+      zero.Fill(itk::NumericTraits<typename TImageType::PixelType::ValueType>::Zero);
+
+      image->FillBuffer(zero);
+    }
   }
   else if constexpr (IsLabel<TImageType>::Value)
   {
@@ -82,11 +82,14 @@ Image::InternalInitialization(PixelIDValueType type, unsigned int dimension, itk
 }
 
 void
-Image::Allocate(const std::vector<unsigned int> & _size, PixelIDValueEnum ValueEnum, unsigned int numberOfComponents)
+Image::Allocate(const std::vector<unsigned int> & _size,
+                PixelIDValueEnum                  ValueEnum,
+                unsigned int                      numberOfComponents,
+                bool                              initializePixels)
 {
   // The pixel IDs supported
   using PixelIDTypeList = AllPixelIDTypeList;
-  typedef void (Self::*MemberFunctionType)(const std::vector<unsigned int> &, unsigned int);
+  typedef void (Self::*MemberFunctionType)(const std::vector<unsigned int> &, unsigned int, bool);
   using AllocateAddressor = AllocateMemberFunctionAddressor;
 
   static const auto allocateMemberFactory = []() {
@@ -107,7 +110,7 @@ Image::Allocate(const std::vector<unsigned int> & _size, PixelIDValueEnum ValueE
                        << "The maximum supported Image dimension is " << SITK_MAX_DIMENSION << ".");
   }
 
-  allocateMemberFactory.GetMemberFunction(ValueEnum, _size.size(), this)(_size, numberOfComponents);
+  allocateMemberFactory.GetMemberFunction(ValueEnum, _size.size(), this)(_size, numberOfComponents, initializePixels);
 }
 
 
@@ -115,6 +118,7 @@ Image
 Image::ToVectorImage(bool inPlace)
 {
   assert(m_PimpleImage);
+  this->m_PimpleImage->UpdateDeferredPipeline();
 
   using PixelIDTypeList = typelist2::append<ScalarPixelIDTypeList, VectorPixelIDTypeList>::type;
   typedef Image (Self::*MemberFunctionType)(bool);
@@ -139,6 +143,7 @@ Image
 Image::ToScalarImage(bool inPlace)
 {
   assert(m_PimpleImage);
+  this->m_PimpleImage->UpdateDeferredPipeline();
 
   using PixelIDTypeList = typelist2::append<ScalarPixelIDTypeList, VectorPixelIDTypeList>::type;
   typedef Image (Self::*MemberFunctionType)(bool);
@@ -0,0 +1,45 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef sitkImageMemoryAccounting_h
+#define sitkImageMemoryAccounting_h
+
+#include "sitkCommon.h"
+#include "sitkPixelIDValues.h"
+
+#include <cstdint>
+
+namespace itk
+{
+class Object;
+
+namespace simple
+{
+
+/** Account for the memory of a pixel buffer owned by an image.
+ *
+ * The pixel container is counted once, and is counted until it is
+ * destroyed. Calling this method again for the same container has no
+ * effect.
+ */
+SITKCommon_HIDDEN void
+AccountImageBufferMemory(const itk::Object * pixelContainer, uint64_t numberOfBytes, PixelIDValueType pixelID);
+
+} // namespace simple
+} // namespace itk
+
+#endif
@@ -0,0 +1,140 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#include "sitkImageMemoryStatistics.h"
+#include "sitkImageMemoryAccounting.h"
+#include "sitkPixelIDTypeLists.h"
+
+#include "itkCommand.h"
+#include "itkObject.h"
+
+#include <algorithm>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+
+namespace itk::simple
+{
+
+namespace
+{
+
+struct ImageMemoryAccounting
+{
+  std::mutex m_Mutex;
+
+  // The accounted pixel containers with their size and pixel type
+  std::unordered_map<const itk::Object *, std::pair<uint64_t, PixelIDValueType>> m_Buffers;
+
+  ImageMemoryStatistics m_Statistics;
+
+  ImageMemoryAccounting()
+  {
+    m_Statistics.LiveBytesPerPixelID.resize(typelist2::length<InstantiatedPixelIDTypeList>::value, 0);
+  }
+};
+
+ImageMemoryAccounting &
+GetImageMemoryAccounting()
+{
+  // Intentionally leaked so that containers destroyed during static
+  // destruction can still be released.
+  static auto * accounting = new ImageMemoryAccounting;
+  return *accounting;
+}
+
+void
+ReleaseImageBufferMemory(const itk::Object * pixelContainer, const itk::EventObject &, void *)
+{
+  ImageMemoryAccounting &     accounting = GetImageMemoryAccounting();
+  std::lock_guard<std::mutex> lock(accounting.m_Mutex);
+
+  auto iter = accounting.m_Buffers.find(pixelContainer);
+  if (iter == accounting.m_Buffers.end())
+  {
+    return;
+  }
+
+  const uint64_t         numberOfBytes = iter->second.first;
+  const PixelIDValueType pixelID = iter->second.second;
+
+  accounting.m_Statistics.LiveBytes -= numberOfBytes;
+  accounting.m_Statistics.NumberOfLiveBuffers -= 1;
+  if (pixelID >= 0 && static_cast<size_t>(pixelID) < accounting.m_Statistics.LiveBytesPerPixelID.size())
+  {
+    accounting.m_Statistics.LiveBytesPerPixelID[pixelID] -= numberOfBytes;
+  }
+  accounting.m_Buffers.erase(iter);
+}
+
+} // namespace
+
+
+void
+AccountImageBufferMemory(const itk::Object * pixelContainer, uint64_t numberOfBytes, PixelIDValueType pixelID)
+{
+  if (pixelContainer == nullptr || numberOfBytes == 0)
+  {
+    return;
+  }
+
+  ImageMemoryAccounting & accounting = GetImageMemoryAccounting();
+  {
+    std::lock_guard<std::mutex> lock(accounting.m_Mutex);
+
+    if (!accounting.m_Buffers.emplace(pixelContainer, std::make_pair(numberOfBytes, pixelID)).second)
+    {
+      // already accounted for
+      return;
+    }
+
+    ImageMemoryStatistics & statistics = accounting.m_Statistics;
+    statistics.LiveBytes += numberOfBytes;
+    statistics.PeakBytes = std::max(statistics.PeakBytes, statistics.LiveBytes);
+    statistics.NumberOfLiveBuffers += 1;
+    statistics.NumberOfAllocations += 1;
+    if (pixelID >= 0 && static_cast<size_t>(pixelID) < statistics.LiveBytesPerPixelID.size())
+    {
+      statistics.LiveBytesPerPixelID[pixelID] += numberOfBytes;
+    }
+  }
+
+  // The DeleteEvent is invoked by the container when its last
+  // reference is removed.
+  auto command = itk::CStyleCommand::New();
+  command->SetConstCallback(ReleaseImageBufferMemory);
+  pixelContainer->AddObserver(itk::DeleteEvent(), command);
+}
+
+
+ImageMemoryStatistics
+GetImageMemoryStatistics()
+{
+  ImageMemoryAccounting &     accounting = GetImageMemoryAccounting();
+  std::lock_guard<std::mutex> lock(accounting.m_Mutex);
+  return accounting.m_Statistics;
+}
+
+void
+ResetImageMemoryPeak()
+{
+  ImageMemoryAccounting &     accounting = GetImageMemoryAccounting();
+  std::lock_guard<std::mutex> lock(accounting.m_Mutex);
+  accounting.m_Statistics.PeakBytes = accounting.m_Statistics.LiveBytes;
+}
+
+} // namespace itk::simple
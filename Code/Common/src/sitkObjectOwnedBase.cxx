@@ -35,6 +35,7 @@ ObjectOwnedBase::ObjectOwnedBase(const ObjectOwnedBase & o)
   {
     sitkExceptionMacro("Unable to copy object with OwnedByObjects enabled.");
   }
+  std::lock_guard<std::mutex> lock(o.m_ReferencedObjectsMutex);
   m_ReferencedObjectsCallbacks = o.m_ReferencedObjectsCallbacks;
 }
 
@@ -56,6 +57,7 @@ size_t
 ObjectOwnedBase::AddObjectCallback(itk::Object * o, std::function<void()> onDelete)
 {
   // add new element and callback ( even if it already exists )
+  std::lock_guard<std::mutex> lock(m_ReferencedObjectsMutex);
   m_ReferencedObjectsCallbacks.emplace(o, std::move(onDelete));
   return m_ReferencedObjectsCallbacks.size();
 }
@@ -63,9 +65,13 @@ ObjectOwnedBase::AddObjectCallback(itk::Object * o, std::function<void()> onDele
 size_t
 ObjectOwnedBase::RemoveObject(const itk::Object * co)
 {
-  // removes all elements matching
-  m_ReferencedObjectsCallbacks.erase(const_cast<itk::Object *>(co));
-  const size_t ret = m_ReferencedObjectsCallbacks.size();
+  size_t ret = 0;
+  {
+    // removes all elements matching
+    std::lock_guard<std::mutex> lock(m_ReferencedObjectsMutex);
+    m_ReferencedObjectsCallbacks.erase(const_cast<itk::Object *>(co));
+    ret = m_ReferencedObjectsCallbacks.size();
+  }
   if (ret == 0 && GetOwnedByObjects())
   {
     delete this;
@@ -76,7 +82,12 @@ ObjectOwnedBase::RemoveObject(const itk::Object * co)
 void
 ObjectOwnedBase::SetOwnedByObjects(bool o)
 {
-  if (m_ReferencedObjectsCallbacks.empty())
+  bool empty = false;
+  {
+    std::lock_guard<std::mutex> lock(m_ReferencedObjectsMutex);
+    empty = m_ReferencedObjectsCallbacks.empty();
+  }
+  if (empty)
   {
     // AddObjectCallback must be called before setting ownership.
     sitkWarningMacro("No objects known to own this object.")
@@ -108,13 +119,17 @@ ObjectOwnedBase::ExecuteCallbacks()
 {
   // move to local variable to prevent any call backs modifying the multimap of objects
   decltype(m_ReferencedObjectsCallbacks) referencedObjects;
-  referencedObjects.swap(m_ReferencedObjectsCallbacks);
+  {
+    std::lock_guard<std::mutex> lock(m_ReferencedObjectsMutex);
+    referencedObjects.swap(m_ReferencedObjectsCallbacks);
+  }
 
   for (auto & p : referencedObjects)
   {
     p.second();
   }
 
+  std::lock_guard<std::mutex> lock(m_ReferencedObjectsMutex);
   if (!m_ReferencedObjectsCallbacks.empty())
   {
     sitkWarningMacro("Detected modification of referenced objects during callback execution!")
@@ -18,13 +18,44 @@
 #ifndef sitkPimpleImageBase_h
 #define sitkPimpleImageBase_h
 
+#include <memory>
+#include <mutex>
 #include <vector>
 #include "sitkPixelIDTokens.h"
 #include "sitkTemplateFunctions.h"
 
+namespace itk
+{
+class ProcessObject;
+}
+
 namespace itk::simple
 {
 
+/** \class DeferredPipelineLock
+ * \brief Serialize the update of a deferred pipeline.
+ *
+ * Each ITK filter of a deferred execution has a mutex, which is
+ * shared by all the images holding the filter. The lock of an image
+ * locks the mutexes of all the filters of its pipeline, as the
+ * filters may be shared with the pipelines of other images, so only
+ * images with a common filter are updated one at a time. The mutexes
+ * are locked in the order of their address to avoid a deadlock.
+ */
+class SITKCommon_HIDDEN DeferredPipelineLock
+{
+public:
+  explicit DeferredPipelineLock(const std::vector<itk::ProcessObject *> & pipeline);
+
+  void
+  lock();
+  void
+  unlock();
+
+private:
+  std::vector<std::shared_ptr<std::mutex>> m_Mutexes;
+};
+
 /** \class PimpleImageBase
  * \brief Private implementation idiom image base class
  *
@@ -117,6 +148,8 @@ public:
 
   virtual std::vector<double>
   EvaluateAtContinuousIndex(const std::vector<double> & index, InterpolatorEnum interp) const = 0;
+  virtual std::vector<double>
+  EvaluateAtPhysicalPoints(const std::vector<double> & points, InterpolatorEnum interp) const = 0;
 
   virtual std::string
   ToString() const = 0;
@@ -124,6 +157,22 @@ public:
   virtual int
   GetReferenceCountOfImage() const = 0;
 
+  /** Hold the ITK filters of a deferred execution which produces
+   * this image, the ITK image is the un-updated output of the first
+   * filter. */
+  virtual void
+  SetDeferredPipeline(const std::vector<itk::ProcessObject *> & pipeline) = 0;
+
+  /** Query if the image is the output of a deferred execution which
+   * has not been updated. */
+  virtual bool
+  IsDeferred() const = 0;
+
+  /** Update the ITK pipeline of a deferred execution, then
+   * disconnect the image from it and release the filters. */
+  virtual void
+  UpdateDeferredPipeline() = 0;
+
   virtual int8_t
   GetPixelAsInt8(const std::vector<uint32_t> & idx) const = 0;
   virtual uint8_t
@@ -218,6 +267,48 @@ public:
   virtual void
   SetPixelAsComplexFloat64(const std::vector<uint32_t> & idx, const std::complex<double> v) = 0;
 
+  virtual std::vector<int8_t>
+  GetPixelsAsInt8(const std::vector<uint32_t> & indices) const = 0;
+  virtual std::vector<uint8_t>
+  GetPixelsAsUInt8(const std::vector<uint32_t> & indices) const = 0;
+  virtual std::vector<int16_t>
+  GetPixelsAsInt16(const std::vector<uint32_t> & indices) const = 0;
+  virtual std::vector<uint16_t>
+  GetPixelsAsUInt16(const std::vector<uint32_t> & indices) const = 0;
+  virtual std::vector<int32_t>
+  GetPixelsAsInt32(const std::vector<uint32_t> & indices) const = 0;
+  virtual std::vector<uint32_t>
+  GetPixelsAsUInt32(const std::vector<uint32_t> & indices) const = 0;
+  virtual std::vector<int64_t>
+  GetPixelsAsInt64(const std::vector<uint32_t> & indices) const = 0;
+  virtual std::vector<uint64_t>
+  GetPixelsAsUInt64(const std::vector<uint32_t> & indices) const = 0;
+  virtual std::vector<float>
+  GetPixelsAsFloat(const std::vector<uint32_t> & indices) const = 0;
+  virtual std::vector<double>
+  GetPixelsAsDouble(const std::vector<uint32_t> & indices) const = 0;
+
+  virtual void
+  SetPixelsAsInt8(const std::vector<uint32_t> & indices, const std::vector<int8_t> & values) = 0;
+  virtual void
+  SetPixelsAsUInt8(const std::vector<uint32_t> & indices, const std::vector<uint8_t> & values) = 0;
+  virtual void
+  SetPixelsAsInt16(const std::vector<uint32_t> & indices, const std::vector<int16_t> & values) = 0;
+  virtual void
+  SetPixelsAsUInt16(const std::vector<uint32_t> & indices, const std::vector<uint16_t> & values) = 0;
+  virtual void
+  SetPixelsAsInt32(const std::vector<uint32_t> & indices, const std::vector<int32_t> & values) = 0;
+  virtual void
+  SetPixelsAsUInt32(const std::vector<uint32_t> & indices, const std::vector<uint32_t> & values) = 0;
+  virtual void
+  SetPixelsAsInt64(const std::vector<uint32_t> & indices, const std::vector<int64_t> & values) = 0;
+  virtual void
+  SetPixelsAsUInt64(const std::vector<uint32_t> & indices, const std::vector<uint64_t> & values) = 0;
+  virtual void
+  SetPixelsAsFloat(const std::vector<uint32_t> & indices, const std::vector<float> & values) = 0;
+  virtual void
+  SetPixelsAsDouble(const std::vector<uint32_t> & indices, const std::vector<double> & values) = 0;
+
 
   virtual int8_t *
   GetBufferAsInt8() = 0;
@@ -23,14 +23,21 @@
 #include "sitkConditional.h"
 #include "sitkCreateInterpolator.hxx"
 #include "sitkImageConvert.hxx"
+#include "sitkImageMemoryAccounting.h"
 
 #include "itkImage.h"
 #include "itkVectorImage.h"
 #include "itkLabelMap.h"
 #include "itkImageDuplicator.h"
 #include "itkConvertLabelMapFilter.h"
+#include "itkMultiThreaderBase.h"
+#include "itkViewImportImageContainer.h"
+#include "itkProcessObject.h"
 
 
+#include <algorithm>
+#include <atomic>
+#include <mutex>
 #include <type_traits>
 
 namespace itk::simple
@@ -101,6 +108,7 @@ public:
       {
         sitkExceptionMacro(<< "The image pixel container is shared by other resources and presents aliasing issue.");
       }
+      AccountPixelContainerMemory(container);
     }
 
     const IndexType & idx = image->GetBufferedRegion().GetIndex();
@@ -117,6 +125,14 @@ public:
   std::unique_ptr<PimpleImageBase>
   ShallowCopy() const override
   {
+    if (this->m_Deferred)
+    {
+      // The output of a deferred execution is validated when it is
+      // updated, the copy shares the pipeline.
+      std::lock_guard<DeferredPipelineLock> lock(*this->m_DeferredPipelineLock);
+      return std::unique_ptr<Self>(
+        new Self(this->m_Image.GetPointer(), this->m_DeferredPipeline, this->m_DeferredPipelineLock));
+    }
     return std::make_unique<Self>(this->m_Image.GetPointer());
   }
 
@@ -348,20 +364,70 @@ public:
                                                   << GetPixelIDValueAsString(this->GetPixelID()))
       }
       itkInterpolator->SetInputImage(this->m_Image.GetPointer());
-      auto result = itkInterpolator->EvaluateAtContinuousIndex(cidx);
-      if constexpr (IsVector<ImageType>::Value)
+      std::vector<double> result(this->GetNumberOfInterpolatedValues());
+      CopyInterpolatedValue(itkInterpolator->EvaluateAtContinuousIndex(cidx), result.data());
+      return result;
+    }
+  }
+
+  std::vector<double>
+  EvaluateAtPhysicalPoints(const std::vector<double> & points, [[maybe_unused]] InterpolatorEnum interp) const override
+  {
+    if constexpr (IsLabel<ImageType>::Value)
+    {
+      sitkExceptionMacro("Interpolation is not supported for label pixel types.")
+    }
+    else
+    {
+      constexpr unsigned int Dimension = ImageType::ImageDimension;
+      using ContinuousIndexType = itk::ContinuousIndex<double, Dimension>;
+
+      if (points.size() % Dimension != 0)
       {
-        return std::vector<double>{ result.GetDataPointer(), result.GetDataPointer() + result.Size() };
+        sitkExceptionMacro(<< "The length of the points array " << points.size()
+                           << " is not a multiple of the image dimension " << Dimension << ".");
       }
-      else if constexpr (typelist2::has_type<ComplexPixelIDTypeList,
-                                             typename ImageTypeToPixelID<ImageType>::PixelIDType>::value)
+
+      // All points are transformed and checked before any interpolation is done
+      const size_t                     numberOfPoints = points.size() / Dimension;
+      std::vector<ContinuousIndexType> cindices(numberOfPoints);
+      typename ImageType::PointType    pt;
+      for (size_t i = 0; i < numberOfPoints; ++i)
       {
-        return { { double(result.real()), double(result.imag()) } };
+        std::copy_n(&points[i * Dimension], Dimension, pt.GetDataPointer());
+        cindices[i] = this->m_Image->template TransformPhysicalPointToContinuousIndex<double>(pt);
+        if (!this->m_Image->GetLargestPossibleRegion().IsInside(cindices[i]))
+        {
+          sitkExceptionMacro("The point " << pt << " at position " << i << " is outside the image.");
+        }
       }
-      else
+
+      auto itkInterpolator = CreateInterpolator(this->m_Image.GetPointer(), interp);
+      if (itkInterpolator == nullptr)
       {
-        return std::vector<double>(1, double(result));
+        sitkExceptionMacro("Interpolator type \"" << interp << "\" does not support "
+                                                  << GetPixelIDValueAsString(this->GetPixelID()))
       }
+
+      const size_t        numberOfValues = this->GetNumberOfInterpolatedValues();
+      std::vector<double> result(numberOfPoints * numberOfValues);
+      if (numberOfPoints == 0)
+      {
+        return result;
+      }
+
+      // The interpolator, and any coefficients it computes, is shared between all the threads.
+      itkInterpolator->SetInputImage(this->m_Image.GetPointer());
+
+      auto mt = itk::MultiThreaderBase::New();
+      mt->ParallelizeArray(
+        0,
+        numberOfPoints,
+        [&itkInterpolator, &cindices, &result, numberOfValues](SizeValueType i) {
+          CopyInterpolatedValue(itkInterpolator->EvaluateAtContinuousIndex(cindices[i]), &result[i * numberOfValues]);
+        },
+        nullptr);
+      return result;
     }
   }
 
@@ -433,7 +499,70 @@ public:
   int
   GetReferenceCountOfImage() const override
   {
-    return this->m_Image->GetReferenceCount();
+    int referenceCount = this->m_Image->GetReferenceCount();
+    if constexpr (!IsLabel<ImageType>::Value)
+    {
+      // A view shares the buffer of another image, the additional
+      // reference ensures the view is copied before modification.
+      using ViewContainerType =
+        itk::ViewImportImageContainer<typename ImageType::PixelContainer::ElementIdentifier,
+                                      typename ImageType::PixelContainer::Element>;
+      if (dynamic_cast<const ViewContainerType *>(this->m_Image->GetPixelContainer()) != nullptr)
+      {
+        ++referenceCount;
+      }
+    }
+    return referenceCount;
+  }
+
+  void
+  SetDeferredPipeline(const std::vector<itk::ProcessObject *> & pipeline) override
+  {
+    // called by the execution producing the image, before it is shared
+    this->m_DeferredPipelineLock = std::make_shared<DeferredPipelineLock>(pipeline);
+    this->m_DeferredPipeline.assign(pipeline.begin(), pipeline.end());
+    this->m_Deferred = !this->m_DeferredPipeline.empty();
+  }
+
+  bool
+  IsDeferred() const override
+  {
+    return this->m_Deferred;
+  }
+
+  void
+  UpdateDeferredPipeline() override
+  {
+    if (!this->m_Deferred)
+    {
+      return;
+    }
+
+    // the filters are released after the lock
+    std::vector<itk::ProcessObject::Pointer> pipeline;
+
+    std::lock_guard<DeferredPipelineLock> lock(*this->m_DeferredPipelineLock);
+    if (this->m_Image->GetSource())
+    {
+      this->m_Image->UpdateOutputInformation();
+      this->m_Image->SetRequestedRegionToLargestPossibleRegion();
+      this->m_Image->Update();
+
+      // The image may be shared with the pipelines of other deferred
+      // images, its data must no longer be released by them.
+      this->m_Image->ReleaseDataFlagOff();
+      this->m_Image->DisconnectPipeline();
+
+      // SimpleITK images have a zero starting index
+      FixNonZeroIndex(this->m_Image.GetPointer());
+
+      if constexpr (!IsLabel<ImageType>::Value)
+      {
+        AccountPixelContainerMemory(this->m_Image->GetPixelContainer());
+      }
+    }
+    pipeline.swap(this->m_DeferredPipeline);
+    this->m_Deferred = false;
   }
 
   int8_t
@@ -771,7 +900,170 @@ public:
     InternalSetPixelAs<std::complex<double>>(idx, v);
   }
 
+  std::vector<int8_t>
+  GetPixelsAsInt8(const std::vector<uint32_t> & indices) const override
+  {
+    return this->InternalGetPixelsAs<int8_t>(indices);
+  }
+  std::vector<uint8_t>
+  GetPixelsAsUInt8(const std::vector<uint32_t> & indices) const override
+  {
+    return this->InternalGetPixelsAs<uint8_t>(indices);
+  }
+  std::vector<int16_t>
+  GetPixelsAsInt16(const std::vector<uint32_t> & indices) const override
+  {
+    return this->InternalGetPixelsAs<int16_t>(indices);
+  }
+  std::vector<uint16_t>
+  GetPixelsAsUInt16(const std::vector<uint32_t> & indices) const override
+  {
+    return this->InternalGetPixelsAs<uint16_t>(indices);
+  }
+  std::vector<int32_t>
+  GetPixelsAsInt32(const std::vector<uint32_t> & indices) const override
+  {
+    return this->InternalGetPixelsAs<int32_t>(indices);
+  }
+  std::vector<uint32_t>
+  GetPixelsAsUInt32(const std::vector<uint32_t> & indices) const override
+  {
+    return this->InternalGetPixelsAs<uint32_t>(indices);
+  }
+  std::vector<int64_t>
+  GetPixelsAsInt64(const std::vector<uint32_t> & indices) const override
+  {
+    return this->InternalGetPixelsAs<int64_t>(indices);
+  }
+  std::vector<uint64_t>
+  GetPixelsAsUInt64(const std::vector<uint32_t> & indices) const override
+  {
+    return this->InternalGetPixelsAs<uint64_t>(indices);
+  }
+  std::vector<float>
+  GetPixelsAsFloat(const std::vector<uint32_t> & indices) const override
+  {
+    return this->InternalGetPixelsAs<float>(indices);
+  }
+  std::vector<double>
+  GetPixelsAsDouble(const std::vector<uint32_t> & indices) const override
+  {
+    return this->InternalGetPixelsAs<double>(indices);
+  }
+
+  void
+  SetPixelsAsInt8(const std::vector<uint32_t> & indices, const std::vector<int8_t> & values) override
+  {
+    this->InternalSetPixelsAs<int8_t>(indices, values);
+  }
+  void
+  SetPixelsAsUInt8(const std::vector<uint32_t> & indices, const std::vector<uint8_t> & values) override
+  {
+    this->InternalSetPixelsAs<uint8_t>(indices, values);
+  }
+  void
+  SetPixelsAsInt16(const std::vector<uint32_t> & indices, const std::vector<int16_t> & values) override
+  {
+    this->InternalSetPixelsAs<int16_t>(indices, values);
+  }
+  void
+  SetPixelsAsUInt16(const std::vector<uint32_t> & indices, const std::vector<uint16_t> & values) override
+  {
+    this->InternalSetPixelsAs<uint16_t>(indices, values);
+  }
+  void
+  SetPixelsAsInt32(const std::vector<uint32_t> & indices, const std::vector<int32_t> & values) override
+  {
+    this->InternalSetPixelsAs<int32_t>(indices, values);
+  }
+  void
+  SetPixelsAsUInt32(const std::vector<uint32_t> & indices, const std::vector<uint32_t> & values) override
+  {
+    this->InternalSetPixelsAs<uint32_t>(indices, values);
+  }
+  void
+  SetPixelsAsInt64(const std::vector<uint32_t> & indices, const std::vector<int64_t> & values) override
+  {
+    this->InternalSetPixelsAs<int64_t>(indices, values);
+  }
+  void
+  SetPixelsAsUInt64(const std::vector<uint32_t> & indices, const std::vector<uint64_t> & values) override
+  {
+    this->InternalSetPixelsAs<uint64_t>(indices, values);
+  }
+  void
+  SetPixelsAsFloat(const std::vector<uint32_t> & indices, const std::vector<float> & values) override
+  {
+    this->InternalSetPixelsAs<float>(indices, values);
+  }
+  void
+  SetPixelsAsDouble(const std::vector<uint32_t> & indices, const std::vector<double> & values) override
+  {
+    this->InternalSetPixelsAs<double>(indices, values);
+  }
+
 protected:
+  // Account for the memory of the pixel buffer, if it is owned by
+  // the image.
+  template <typename TContainer>
+  static void
+  AccountPixelContainerMemory(const TContainer * container)
+  {
+    using ElementIdentifier = typename TContainer::ElementIdentifier;
+    using Element = typename TContainer::Element;
+
+    if (dynamic_cast<const itk::ViewImportImageContainer<ElementIdentifier, Element> *>(container) != nullptr)
+    {
+      return;
+    }
+    if (container->GetContainerManageMemory() ||
+        dynamic_cast<const itk::DeleterImportImageContainer<ElementIdentifier, Element> *>(container) != nullptr)
+    {
+      AccountImageBufferMemory(container,
+                               static_cast<uint64_t>(container->Capacity()) * sizeof(Element),
+                               ImageTypeToPixelIDValue<ImageType>::Result);
+    }
+  }
+
+  /** The number of doubles returned for each interpolated pixel. */
+  size_t
+  GetNumberOfInterpolatedValues() const
+  {
+    if constexpr (IsVector<ImageType>::Value)
+    {
+      return this->m_Image->GetNumberOfComponentsPerPixel();
+    }
+    else if constexpr (typelist2::has_type<ComplexPixelIDTypeList,
+                                           typename ImageTypeToPixelID<ImageType>::PixelIDType>::value)
+    {
+      return 2;
+    }
+    else
+    {
+      return 1;
+    }
+  }
+
+  template <typename TValue>
+  static void
+  CopyInterpolatedValue(const TValue & value, double * out)
+  {
+    if constexpr (IsVector<ImageType>::Value)
+    {
+      std::copy_n(value.GetDataPointer(), value.Size(), out);
+    }
+    else if constexpr (typelist2::has_type<ComplexPixelIDTypeList,
+                                           typename ImageTypeToPixelID<ImageType>::PixelIDType>::value)
+    {
+      out[0] = double(value.real());
+      out[1] = double(value.imag());
+    }
+    else
+    {
+      out[0] = double(value);
+    }
+  }
+
   IndexType
   GetIndex(const std::vector<uint32_t> & idx) const
   {
@@ -872,9 +1164,195 @@ protected:
     }
   }
 
+  /** Converts a flat array of indices into offsets of pixels in the
+   * buffer, checking every index against the largest possible region. */
+  std::vector<size_t>
+  ComputeBufferOffsets(const std::vector<uint32_t> & indices) const
+  {
+    constexpr unsigned int Dimension = ImageType::ImageDimension;
+
+    if (indices.size() % Dimension != 0)
+    {
+      sitkExceptionMacro(<< "The length of the indices array " << indices.size()
+                         << " is not a multiple of the image dimension " << Dimension << ".");
+    }
+
+    const typename ImageType::SizeType size = this->m_Image->GetLargestPossibleRegion().GetSize();
+    const OffsetValueType *            offsetTable = this->m_Image->GetOffsetTable();
+
+    std::vector<size_t> offsets(indices.size() / Dimension);
+    const uint32_t *    idx = indices.data();
+    for (size_t i = 0; i < offsets.size(); ++i, idx += Dimension)
+    {
+      size_t offset = 0;
+      for (unsigned int d = 0; d < Dimension; ++d)
+      {
+        if (idx[d] >= size[d])
+        {
+          sitkExceptionMacro("index out of bounds");
+        }
+        offset += static_cast<size_t>(idx[d]) * static_cast<size_t>(offsetTable[d]);
+      }
+      offsets[i] = offset;
+    }
+    return offsets;
+  }
+
+  /** The number of TComponent values stored in the buffer for each pixel. */
+  template <typename TComponent>
+  size_t
+  GetNumberOfBufferValuesPerPixel() const
+  {
+    if constexpr (IsVector<ImageType>::Value)
+    {
+      return this->m_Image->GetNumberOfComponentsPerPixel();
+    }
+    else
+    {
+      return sizeof(ValuePixelType) / sizeof(TComponent);
+    }
+  }
+
+  template <typename TComponent>
+  std::vector<TComponent>
+  InternalGetPixelsAs(const std::vector<uint32_t> & indices) const
+  {
+    if constexpr (IsLabel<ImageType>::Value)
+    {
+      if constexpr (std::is_same<ValuePixelType, TComponent>::value)
+      {
+        constexpr unsigned int Dimension = ImageType::ImageDimension;
+
+        // verifies the layout and bounds of all the indices
+        const std::vector<size_t> offsets = this->ComputeBufferOffsets(indices);
+
+        std::vector<TComponent> result(offsets.size());
+        IndexType               itkIdx;
+        for (size_t i = 0; i < result.size(); ++i)
+        {
+          for (unsigned int d = 0; d < Dimension; ++d)
+          {
+            itkIdx[d] = indices[i * Dimension + d];
+          }
+          result[i] = this->m_Image->GetPixel(itkIdx);
+        }
+        return result;
+      }
+      else
+      {
+        sitkExceptionMacro(<< "The image is of type: " << GetPixelIDValueAsString(this->GetPixelID())
+                           << " but the GetPixels access method does not match the type!");
+      }
+    }
+    else
+    {
+      const TComponent *        buffer = this->InternalGetBufferAs<TComponent>();
+      const size_t              numberOfValues = this->GetNumberOfBufferValuesPerPixel<TComponent>();
+      const std::vector<size_t> offsets = this->ComputeBufferOffsets(indices);
+
+      std::vector<TComponent> result(offsets.size() * numberOfValues);
+      TComponent *            out = result.data();
+      if (numberOfValues == 1)
+      {
+        for (const size_t offset : offsets)
+        {
+          *out++ = buffer[offset];
+        }
+      }
+      else
+      {
+        for (const size_t offset : offsets)
+        {
+          out = std::copy_n(buffer + offset * numberOfValues, numberOfValues, out);
+        }
+      }
+      return result;
+    }
+  }
+
+  template <typename TComponent>
+  void
+  InternalSetPixelsAs(const std::vector<uint32_t> & indices, const std::vector<TComponent> & values)
+  {
+    if constexpr (IsLabel<ImageType>::Value)
+    {
+      if constexpr (std::is_same<ValuePixelType, TComponent>::value)
+      {
+        constexpr unsigned int    Dimension = ImageType::ImageDimension;
+        const std::vector<size_t> offsets = this->ComputeBufferOffsets(indices);
+
+        if (values.size() != offsets.size())
+        {
+          sitkExceptionMacro(<< "Expected " << offsets.size() << " values for " << offsets.size()
+                             << " indices but got " << values.size() << ".");
+        }
+
+        IndexType itkIdx;
+        for (size_t i = 0; i < values.size(); ++i)
+        {
+          for (unsigned int d = 0; d < Dimension; ++d)
+          {
+            itkIdx[d] = indices[i * Dimension + d];
+          }
+          this->m_Image->SetPixel(itkIdx, values[i]);
+        }
+      }
+      else
+      {
+        sitkExceptionMacro(<< "The image is of type: " << GetPixelIDValueAsString(this->GetPixelID())
+                           << " does not match the type of SetPixels method called.");
+      }
+    }
+    else
+    {
+      TComponent *              buffer = this->InternalGetBufferAs<TComponent>();
+      const size_t              numberOfValues = this->GetNumberOfBufferValuesPerPixel<TComponent>();
+      const std::vector<size_t> offsets = this->ComputeBufferOffsets(indices);
+
+      if (values.size() != offsets.size() * numberOfValues)
+      {
+        sitkExceptionMacro(<< "Expected " << offsets.size() * numberOfValues << " values for " << offsets.size()
+                           << " indices but got " << values.size() << ".");
+      }
+
+      const TComponent * in = values.data();
+      if (numberOfValues == 1)
+      {
+        for (const size_t offset : offsets)
+        {
+          buffer[offset] = *in++;
+        }
+      }
+      else
+      {
+        for (const size_t offset : offsets)
+        {
+          std::copy_n(in, numberOfValues, buffer + offset * numberOfValues);
+          in += numberOfValues;
+        }
+      }
+    }
+  }
+
 
 private:
+  PimpleImage(ImageType *                                      image,
+              const std::vector<itk::ProcessObject::Pointer> & deferredPipeline,
+              const std::shared_ptr<DeferredPipelineLock> &    deferredPipelineLock)
+    : m_Image(image)
+    , m_DeferredPipeline(deferredPipeline)
+    , m_DeferredPipelineLock(deferredPipelineLock)
+    , m_Deferred(!deferredPipeline.empty())
+  {}
+
   ImagePointer m_Image;
+
+  // the filters of a deferred execution producing m_Image, the lock
+  // shared by the copies of the image, and the flag to query them
+  // without the lock
+  std::vector<itk::ProcessObject::Pointer> m_DeferredPipeline;
+  std::shared_ptr<DeferredPipelineLock>    m_DeferredPipelineLock;
+  std::atomic<bool>                        m_Deferred{ false };
 };
 
 } // namespace
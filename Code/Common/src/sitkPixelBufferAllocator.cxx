@@ -0,0 +1,393 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#include "sitkPixelBufferAllocator.h"
+#include "sitkImage.h"
+
+#include "itkImportImageContainer.h"
+#include "itkObjectFactoryBase.h"
+#include "itkVersion.h"
+
+#include <algorithm>
+#include <complex>
+#include <cstring>
+#include <iterator>
+#include <new>
+#include <typeinfo>
+#include <utility>
+#include <vector>
+
+namespace itk::simple
+{
+
+namespace
+{
+
+void *
+AlignedAllocate(size_t numberOfBytes)
+{
+  return ::operator new(numberOfBytes, std::align_val_t(PooledPixelBufferAllocator::Alignment));
+}
+
+void
+AlignedDeallocate(void * buffer)
+{
+  ::operator delete(buffer, std::align_val_t(PooledPixelBufferAllocator::Alignment));
+}
+
+
+/** An ITK pixel container which obtains the memory it manages from
+ * the SimpleITK global pixel buffer allocator.
+ *
+ * The allocator is acquired when the container is constructed, so
+ * that buffers are released to the allocator which provided them.
+ */
+template <typename TElement>
+class AllocatorImportImageContainer : public itk::ImportImageContainer<itk::SizeValueType, TElement>
+{
+public:
+  ITK_DISALLOW_COPY_AND_MOVE(AllocatorImportImageContainer);
+
+  using Self = AllocatorImportImageContainer;
+  using Superclass = itk::ImportImageContainer<itk::SizeValueType, TElement>;
+  using Pointer = itk::SmartPointer<Self>;
+  using ConstPointer = itk::SmartPointer<const Self>;
+  using ElementIdentifier = typename Superclass::ElementIdentifier;
+
+  itkFactorylessNewMacro(Self);
+  itkTypeMacro(AllocatorImportImageContainer, ImportImageContainer);
+
+protected:
+  AllocatorImportImageContainer()
+    : m_Allocator(Image::GetGlobalPixelBufferAllocator())
+  {}
+
+  ~AllocatorImportImageContainer() override
+  {
+    // The base class destructor does not call the overridden method.
+    this->DeallocateManagedMemory();
+  }
+
+  TElement *
+  AllocateElements(ElementIdentifier size, bool useValueInitialization) const override
+  {
+    if (!m_Allocator)
+    {
+      return Superclass::AllocateElements(size, useValueInitialization);
+    }
+
+    const size_t numberOfBytes = size * sizeof(TElement);
+    void *       buffer = m_Allocator->Allocate(numberOfBytes);
+    if (useValueInitialization)
+    {
+      std::memset(buffer, 0, numberOfBytes);
+    }
+    m_AllocatedBuffers.emplace_back(buffer, numberOfBytes);
+    return static_cast<TElement *>(buffer);
+  }
+
+  void
+  DeallocateManagedMemory() override
+  {
+    TElement * buffer = this->GetImportPointer();
+
+    // Only memory which was obtained from the allocator is returned to
+    // it, an imported buffer is handled by the base class.
+    auto iter = std::find_if(m_AllocatedBuffers.begin(), m_AllocatedBuffers.end(), [buffer](const auto & b) {
+      return b.first == buffer;
+    });
+    if (buffer != nullptr && iter != m_AllocatedBuffers.end())
+    {
+      if (this->GetContainerManageMemory())
+      {
+        this->ContainerManageMemoryOff();
+        m_Allocator->Deallocate(buffer, iter->second);
+      }
+      m_AllocatedBuffers.erase(iter);
+    }
+    Superclass::DeallocateManagedMemory();
+  }
+
+private:
+  const std::shared_ptr<PixelBufferAllocator> m_Allocator;
+
+  // The buffers obtained from the allocator and their sizes in bytes,
+  // while reallocating both the old and the new buffer are present.
+  mutable std::vector<std::pair<void *, size_t>> m_AllocatedBuffers;
+};
+
+
+/** Object factory overriding the ITK pixel containers of the
+ * component types used by SimpleITK images. */
+class PixelBufferAllocatorFactory : public itk::ObjectFactoryBase
+{
+public:
+  ITK_DISALLOW_COPY_AND_MOVE(PixelBufferAllocatorFactory);
+
+  using Self = PixelBufferAllocatorFactory;
+  using Superclass = itk::ObjectFactoryBase;
+  using Pointer = itk::SmartPointer<Self>;
+  using ConstPointer = itk::SmartPointer<const Self>;
+
+  itkFactorylessNewMacro(Self);
+  itkTypeMacro(PixelBufferAllocatorFactory, ObjectFactoryBase);
+
+  const char *
+  GetITKSourceVersion() const override
+  {
+    return ITK_SOURCE_VERSION;
+  }
+
+  const char *
+  GetDescription() const override
+  {
+    return "SimpleITK pixel buffer allocator factory";
+  }
+
+protected:
+  PixelBufferAllocatorFactory()
+  {
+    this->RegisterContainer<int8_t>();
+    this->RegisterContainer<uint8_t>();
+    this->RegisterContainer<int16_t>();
+    this->RegisterContainer<uint16_t>();
+    this->RegisterContainer<int32_t>();
+    this->RegisterContainer<uint32_t>();
+    this->RegisterContainer<int64_t>();
+    this->RegisterContainer<uint64_t>();
+    this->RegisterContainer<float>();
+    this->RegisterContainer<double>();
+    this->RegisterContainer<std::complex<float>>();
+    this->RegisterContainer<std::complex<double>>();
+  }
+
+  ~PixelBufferAllocatorFactory() override = default;
+
+private:
+  template <typename TElement>
+  void
+  RegisterContainer()
+  {
+    using ContainerType = itk::ImportImageContainer<itk::SizeValueType, TElement>;
+    using OverrideType = AllocatorImportImageContainer<TElement>;
+    this->RegisterOverride(typeid(ContainerType).name(),
+                           typeid(OverrideType).name(),
+                           "SimpleITK pixel buffer allocator container",
+                           true,
+                           itk::CreateObjectFunction<OverrideType>::New());
+  }
+};
+
+
+struct GlobalPixelBufferAllocator
+{
+  std::mutex                            m_Mutex;
+  std::shared_ptr<PixelBufferAllocator> m_Allocator;
+  itk::ObjectFactoryBase::Pointer       m_Factory;
+};
+
+GlobalPixelBufferAllocator &
+GetGlobal()
+{
+  static GlobalPixelBufferAllocator global;
+  return global;
+}
+
+} // namespace
+
+
+void
+Image::SetGlobalPixelBufferAllocator(std::shared_ptr<PixelBufferAllocator> allocator)
+{
+  GlobalPixelBufferAllocator & global = GetGlobal();
+  std::lock_guard<std::mutex>  lock(global.m_Mutex);
+
+  global.m_Allocator = std::move(allocator);
+
+  // The factory is only registered while an allocator is set, so the
+  // default ITK containers are created otherwise.
+  if (global.m_Allocator && !global.m_Factory)
+  {
+    global.m_Factory = PixelBufferAllocatorFactory::New();
+    itk::ObjectFactoryBase::RegisterFactory(global.m_Factory);
+  }
+  else if (!global.m_Allocator && global.m_Factory)
+  {
+    itk::ObjectFactoryBase::UnRegisterFactory(global.m_Factory);
+    global.m_Factory = nullptr;
+  }
+}
+
+std::shared_ptr<PixelBufferAllocator>
+Image::GetGlobalPixelBufferAllocator()
+{
+  GlobalPixelBufferAllocator & global = GetGlobal();
+  std::lock_guard<std::mutex>  lock(global.m_Mutex);
+  return global.m_Allocator;
+}
+
+
+PixelBufferAllocator::~PixelBufferAllocator() = default;
+
+
+PooledPixelBufferAllocator::PooledPixelBufferAllocator() = default;
+
+PooledPixelBufferAllocator::~PooledPixelBufferAllocator() { this->ReleaseHeldBuffers(); }
+
+size_t
+PooledPixelBufferAllocator::GetSizeClass(size_t numberOfBytes) const
+{
+  // The size class does not depend on the MinimumPooledSize, so a
+  // buffer is released to the same size class it was allocated with.
+  if (numberOfBytes < PoolGranularity)
+  {
+    return numberOfBytes;
+  }
+  return (numberOfBytes + PoolGranularity - 1) / PoolGranularity * PoolGranularity;
+}
+
+void *
+PooledPixelBufferAllocator::Allocate(size_t numberOfBytes)
+{
+  const size_t sizeClass = this->GetSizeClass(numberOfBytes);
+
+  {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    if (sizeClass >= m_MinimumPooledSize)
+    {
+      auto iter = m_HeldBuffers.find(sizeClass);
+      if (iter != m_HeldBuffers.end())
+      {
+        void * buffer = iter->second;
+        m_HeldBuffers.erase(iter);
+        m_BytesHeld -= sizeClass;
+        ++m_NumberOfHits;
+        return buffer;
+      }
+      ++m_NumberOfMisses;
+    }
+  }
+
+  return AlignedAllocate(sizeClass);
+}
+
+void
+PooledPixelBufferAllocator::Deallocate(void * buffer, size_t numberOfBytes)
+{
+  if (buffer == nullptr)
+  {
+    return;
+  }
+
+  const size_t sizeClass = this->GetSizeClass(numberOfBytes);
+
+  {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    if (sizeClass >= m_MinimumPooledSize && m_BytesHeld + sizeClass <= m_MaximumBytesHeld)
+    {
+      m_HeldBuffers.emplace(sizeClass, buffer);
+      m_BytesHeld += sizeClass;
+      return;
+    }
+  }
+
+  AlignedDeallocate(buffer);
+}
+
+void
+PooledPixelBufferAllocator::SetMinimumPooledSize(size_t numberOfBytes)
+{
+  std::lock_guard<std::mutex> lock(m_Mutex);
+  m_MinimumPooledSize = numberOfBytes;
+}
+
+size_t
+PooledPixelBufferAllocator::GetMinimumPooledSize() const
+{
+  std::lock_guard<std::mutex> lock(m_Mutex);
+  return m_MinimumPooledSize;
+}
+
+void
+PooledPixelBufferAllocator::SetMaximumBytesHeld(size_t numberOfBytes)
+{
+  std::lock_guard<std::mutex> lock(m_Mutex);
+  m_MaximumBytesHeld = numberOfBytes;
+  this->TrimToMaximumBytesHeld();
+}
+
+size_t
+PooledPixelBufferAllocator::GetMaximumBytesHeld() const
+{
+  std::lock_guard<std::mutex> lock(m_Mutex);
+  return m_MaximumBytesHeld;
+}
+
+uint64_t
+PooledPixelBufferAllocator::GetNumberOfHits() const
+{
+  std::lock_guard<std::mutex> lock(m_Mutex);
+  return m_NumberOfHits;
+}
+
+uint64_t
+PooledPixelBufferAllocator::GetNumberOfMisses() const
+{
+  std::lock_guard<std::mutex> lock(m_Mutex);
+  return m_NumberOfMisses;
+}
+
+size_t
+PooledPixelBufferAllocator::GetBytesHeld() const
+{
+  std::lock_guard<std::mutex> lock(m_Mutex);
+  return m_BytesHeld;
+}
+
+size_t
+PooledPixelBufferAllocator::GetNumberOfBuffersHeld() const
+{
+  std::lock_guard<std::mutex> lock(m_Mutex);
+  return m_HeldBuffers.size();
+}
+
+void
+PooledPixelBufferAllocator::ReleaseHeldBuffers()
+{
+  std::lock_guard<std::mutex> lock(m_Mutex);
+  for (auto & held : m_HeldBuffers)
+  {
+    AlignedDeallocate(held.second);
+  }
+  m_HeldBuffers.clear();
+  m_BytesHeld = 0;
+}
+
+void
+PooledPixelBufferAllocator::TrimToMaximumBytesHeld()
+{
+  // the largest buffers are freed first
+  while (m_BytesHeld > m_MaximumBytesHeld && !m_HeldBuffers.empty())
+  {
+    auto iter = std::prev(m_HeldBuffers.end());
+    AlignedDeallocate(iter->second);
+    m_BytesHeld -= iter->first;
+    m_HeldBuffers.erase(iter);
+  }
+}
+
+} // namespace itk::simple
@@ -17,17 +17,33 @@
  *=========================================================================*/
 #include "sitkProcessObject.h"
 #include "sitkCommand.h"
+#include "sitkExecutionTrace.h"
+#include "sitkPixelIDTypeLists.h"
+#include "sitkPixelIDTypes.h"
+#include "sitkResultCacheInternal.h"
 
 #include "itkProcessObject.h"
 #include "itkCommand.h"
 #include "sitkFunctionCommand.h"
 #include "itkImageToImageFilter.h"
 #include "itkTextOutput.h"
+#include "itkImage.h"
+#include "itkVectorImage.h"
 
 #include <iostream>
 #include <algorithm>
+#include <chrono>
 #include <cstring>
+#include <condition_variable>
+#include <ctime>
+#include <deque>
+#include <exception>
 #include <functional>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <typeindex>
+#include <unordered_map>
 
 namespace itk::simple
 {
@@ -35,6 +51,7 @@ namespace itk::simple
 namespace
 {
 static bool GlobalDefaultDebug = false;
+static bool GlobalDefaultDeferredExecution = false;
 
 static itk::AnyEvent                      eventAnyEvent;
 static itk::AbortEvent                    eventAbortEvent;
@@ -96,9 +113,293 @@ protected:
   ~SimpleAdaptorCommand() override = default;
 };
 
+
+// The address and the number of bytes of the pixel buffer of a data object
+using PixelBufferType = std::pair<const void *, uint64_t>;
+using PixelBufferFunctionType = PixelBufferType (*)(const itk::DataObject *);
+using PixelBufferFunctionMapType = std::unordered_map<std::type_index, PixelBufferFunctionType>;
+
+template <typename TImageType>
+PixelBufferType
+GetImagePixelBuffer(const itk::DataObject * dataObject)
+{
+  const auto * image = static_cast<const TImageType *>(dataObject);
+  if (image->GetPixelContainer() == nullptr)
+  {
+    return { nullptr, 0 };
+  }
+  return { image->GetBufferPointer(),
+           image->GetPixelContainer()->Size() * sizeof(typename TImageType::PixelContainer::Element) };
+}
+
+template <typename TPixelIDTypeList, unsigned int VImageDimension>
+struct AddPixelBufferFunctions;
+template <unsigned int VImageDimension, typename... TPixelIDs>
+struct AddPixelBufferFunctions<typelist2::typelist<TPixelIDs...>, VImageDimension>
+{
+  static void
+  op(PixelBufferFunctionMapType & functions)
+  {
+    (functions.emplace(typeid(typename PixelIDToImageType<TPixelIDs, VImageDimension>::ImageType),
+                       &GetImagePixelBuffer<typename PixelIDToImageType<TPixelIDs, VImageDimension>::ImageType>),
+     ...);
+    if constexpr (VImageDimension < SITK_MAX_DIMENSION)
+    {
+      AddPixelBufferFunctions<typelist2::typelist<TPixelIDs...>, VImageDimension + 1>::op(functions);
+    }
+  }
+};
+
+// Get the pixel buffer of a data object, which is known for the
+// image types of SimpleITK images.
+PixelBufferType
+GetPixelBuffer(const itk::DataObject * dataObject)
+{
+  static const PixelBufferFunctionMapType functions = [] {
+    PixelBufferFunctionMapType f;
+    AddPixelBufferFunctions<NonLabelPixelIDTypeList, 2>::op(f);
+    return f;
+  }();
+
+  if (dataObject == nullptr)
+  {
+    return { nullptr, 0 };
+  }
+
+  auto iter = functions.find(typeid(*dataObject));
+  if (iter == functions.end())
+  {
+    return { nullptr, 0 };
+  }
+  return iter->second(dataObject);
+}
+
+
+// The processor time of the whole process. A per-thread clock would
+// not include the ITK threads doing the work of an execution.
+double
+GetCPUClockSeconds()
+{
+  return static_cast<double>(std::clock()) / CLOCKS_PER_SEC;
+}
+
+
+struct GlobalExecutionStatistics
+{
+  std::mutex                                        m_Mutex;
+  std::map<std::string, ExecutionStatisticsSummary> m_Summaries;
+};
+
+GlobalExecutionStatistics &
+GetGlobalExecutionStatisticsInstance()
+{
+  static GlobalExecutionStatistics instance;
+  return instance;
+}
+
+void
+AddGlobalExecutionStatistics(const ExecutionStatistics & stats)
+{
+  GlobalExecutionStatistics & global = GetGlobalExecutionStatisticsInstance();
+  std::lock_guard<std::mutex> lock(global.m_Mutex);
+
+  ExecutionStatisticsSummary & summary = global.m_Summaries[stats.Name];
+  summary.Name = stats.Name;
+  summary.NumberOfExecutions += 1;
+  summary.TotalWallTime += stats.WallTime;
+  summary.MaximumWallTime = std::max(summary.MaximumWallTime, stats.WallTime);
+  summary.TotalCPUTime += stats.CPUTime;
+  summary.TotalInputBytes += stats.InputBytes;
+  summary.TotalOutputBytes += stats.OutputBytes;
+  summary.TotalAllocatedBytes += stats.AllocatedBytes;
+}
+
+
+// A queue of tasks run by a bounded number of threads. The threads
+// are started when tasks are queued, and exit when the concurrency
+// is reduced.
+class AsyncExecutor
+{
+public:
+  void
+  Enqueue(std::function<void()> task)
+  {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    m_Tasks.push_back(std::move(task));
+    this->StartThreads();
+    m_Condition.notify_one();
+  }
+
+  void
+  SetConcurrency(unsigned int n)
+  {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    m_Concurrency = std::max(n, 1u);
+    this->StartThreads();
+    m_Condition.notify_all();
+  }
+
+  unsigned int
+  GetConcurrency()
+  {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    return m_Concurrency;
+  }
+
+private:
+  // Start threads for the queued tasks without an idle thread, the
+  // mutex must be locked.
+  void
+  StartThreads()
+  {
+    while (m_NumberOfThreads < m_Concurrency && m_Tasks.size() > m_NumberOfIdleThreads)
+    {
+      ++m_NumberOfThreads;
+      ++m_NumberOfIdleThreads;
+      std::thread([this] { this->Run(); }).detach();
+    }
+  }
+
+  void
+  Run()
+  {
+    std::unique_lock<std::mutex> lock(m_Mutex);
+    while (true)
+    {
+      m_Condition.wait(lock, [this] { return !m_Tasks.empty() || m_NumberOfThreads > m_Concurrency; });
+      if (m_NumberOfThreads > m_Concurrency)
+      {
+        --m_NumberOfThreads;
+        --m_NumberOfIdleThreads;
+        return;
+      }
+
+      std::function<void()> task = std::move(m_Tasks.front());
+      m_Tasks.pop_front();
+      --m_NumberOfIdleThreads;
+
+      lock.unlock();
+      task();
+      lock.lock();
+
+      ++m_NumberOfIdleThreads;
+    }
+  }
+
+  std::mutex                        m_Mutex;
+  std::condition_variable           m_Condition;
+  std::deque<std::function<void()>> m_Tasks;
+  unsigned int                      m_Concurrency{ 2 };
+  unsigned int                      m_NumberOfThreads{ 0 };
+  unsigned int                      m_NumberOfIdleThreads{ 0 };
+};
+
+AsyncExecutor &
+GetAsyncExecutor()
+{
+  // Intentionally leaked, the detached threads of the executor may
+  // still be waiting for tasks when the process exits.
+  static auto * executor = new AsyncExecutor;
+  return *executor;
+}
+
+
+// A thread which calls the timeout function of the executions whose
+// deadline has passed. The thread is started with the first
+// execution with a timeout.
+class ExecutionWatchdog
+{
+public:
+  using Clock = std::chrono::steady_clock;
+
+  void
+  Add(const void * key, double deadline, std::function<void()> onTimeout)
+  {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    const auto                  time =
+      Clock::time_point(std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(deadline)));
+    m_Entries[key] = Entry{ time, std::move(onTimeout) };
+    if (!m_ThreadStarted)
+    {
+      m_ThreadStarted = true;
+      std::thread([this] { this->Run(); }).detach();
+    }
+    m_Condition.notify_one();
+  }
+
+  // After removal the timeout function is not running and will not
+  // be called.
+  void
+  Remove(const void * key)
+  {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    m_Entries.erase(key);
+  }
+
+private:
+  struct Entry
+  {
+    Clock::time_point     m_Deadline;
+    std::function<void()> m_OnTimeout;
+  };
+
+  void
+  Run()
+  {
+    std::unique_lock<std::mutex> lock(m_Mutex);
+    while (true)
+    {
+      if (m_Entries.empty())
+      {
+        m_Condition.wait(lock);
+        continue;
+      }
+
+      auto next = std::min_element(m_Entries.begin(), m_Entries.end(), [](const auto & a, const auto & b) {
+        return a.second.m_Deadline < b.second.m_Deadline;
+      });
+      if (Clock::now() < next->second.m_Deadline)
+      {
+        m_Condition.wait_until(lock, next->second.m_Deadline);
+        continue;
+      }
+
+      // called with the lock held, so the execution can not be
+      // completed concurrently
+      std::function<void()> onTimeout = std::move(next->second.m_OnTimeout);
+      m_Entries.erase(next);
+      onTimeout();
+    }
+  }
+
+  std::mutex                               m_Mutex;
+  std::condition_variable                  m_Condition;
+  std::unordered_map<const void *, Entry> m_Entries;
+  bool                                     m_ThreadStarted{ false };
+};
+
+ExecutionWatchdog &
+GetExecutionWatchdog()
+{
+  // Intentionally leaked, as the detached thread waits on it.
+  static auto * watchdog = new ExecutionWatchdog;
+  return *watchdog;
+}
+
 } // namespace
 
 
+struct ProcessObject::AsyncExecutionState
+{
+  // the copy, and a weak reference to abort it while it executes
+  using ExecutionType = std::pair<const ProcessObject *, std::weak_ptr<ProcessObject>>;
+
+  std::mutex                 Mutex;
+  ProcessObject *            Owner{ nullptr };
+  std::vector<ExecutionType> Executions;
+};
+
+
 ProcessObject::EventCommand::EventCommand(EventEnum e, Command * c)
   : m_Event(e)
   , m_Command(c)
@@ -113,8 +414,10 @@ ProcessObject::EventCommand::EventCommand(EventEnum e, Command * c)
 //
 ProcessObject::ProcessObject()
   : m_Debug(ProcessObject::GetGlobalDefaultDebug())
+  , m_DeferredExecution(ProcessObject::GetGlobalDefaultDeferredExecution())
   , m_NumberOfThreads(itk::MultiThreaderBase::GetGlobalDefaultNumberOfThreads())
   , m_NumberOfWorkUnits(0)
+  , m_NumberOfStreamDivisions(1)
   , m_ActiveProcess(nullptr)
   , m_ProgressMeasurement(0.0)
 {
@@ -135,6 +438,10 @@ ProcessObject::ProcessObject()
 //
 ProcessObject::~ProcessObject()
 {
+  GetExecutionWatchdog().Remove(this);
+
+  this->DetachAsyncExecutions();
+
   // ensure to remove reference between sitk commands and process object
   Self::RemoveAllCommands();
 }
@@ -147,12 +454,21 @@ ProcessObject::ToString() const
   out << "  Debug: ";
   this->ToStringHelper(out, this->m_Debug) << std::endl;
 
+  out << "  DeferredExecution: ";
+  this->ToStringHelper(out, this->m_DeferredExecution) << std::endl;
+
   out << "  NumberOfThreads: ";
   this->ToStringHelper(out, this->m_NumberOfThreads) << std::endl;
 
   out << "  NumberOfWorkUnits: ";
   this->ToStringHelper(out, this->m_NumberOfWorkUnits) << std::endl;
 
+  out << "  NumberOfStreamDivisions: ";
+  this->ToStringHelper(out, this->m_NumberOfStreamDivisions) << std::endl;
+
+  out << "  ExecutionTimeout: ";
+  this->ToStringHelper(out, this->m_ExecutionTimeout) << std::endl;
+
   out << "  Commands:" << (m_Commands.empty() ? " (none)" : "") << std::endl;
   for (const auto & eventCommand : m_Commands)
   {
@@ -254,6 +570,62 @@ ProcessObject::SetGlobalDefaultDebug(bool debugFlag)
 }
 
 
+void
+ProcessObject::DeferredExecutionOn()
+{
+  this->m_DeferredExecution = true;
+}
+
+
+void
+ProcessObject::DeferredExecutionOff()
+{
+  this->m_DeferredExecution = false;
+}
+
+
+bool
+ProcessObject::GetDeferredExecution() const
+{
+  return this->m_DeferredExecution;
+}
+
+
+void
+ProcessObject::SetDeferredExecution(bool deferredExecution)
+{
+  this->m_DeferredExecution = deferredExecution;
+}
+
+
+void
+ProcessObject::GlobalDefaultDeferredExecutionOn()
+{
+  GlobalDefaultDeferredExecution = true;
+}
+
+
+void
+ProcessObject::GlobalDefaultDeferredExecutionOff()
+{
+  GlobalDefaultDeferredExecution = false;
+}
+
+
+bool
+ProcessObject::GetGlobalDefaultDeferredExecution()
+{
+  return GlobalDefaultDeferredExecution;
+}
+
+
+void
+ProcessObject::SetGlobalDefaultDeferredExecution(bool deferredExecution)
+{
+  GlobalDefaultDeferredExecution = deferredExecution;
+}
+
+
 void
 ProcessObject::GlobalWarningDisplayOn()
 {
@@ -371,6 +743,20 @@ ProcessObject::GetNumberOfWorkUnits() const
 }
 
 
+void
+ProcessObject::SetNumberOfStreamDivisions(unsigned int n)
+{
+  m_NumberOfStreamDivisions = n;
+}
+
+
+unsigned int
+ProcessObject::GetNumberOfStreamDivisions() const
+{
+  return m_NumberOfStreamDivisions;
+}
+
+
 int
 ProcessObject::AddCommand(EventEnum event, Command & cmd)
 {
@@ -466,6 +852,97 @@ ProcessObject::Abort()
   {
     this->m_ActiveProcess->AbortGenerateDataOn();
   }
+
+  if (this->m_AsyncExecutionState)
+  {
+    std::lock_guard<std::mutex> lock(this->m_AsyncExecutionState->Mutex);
+    for (const auto & execution : this->m_AsyncExecutionState->Executions)
+    {
+      if (std::shared_ptr<ProcessObject> copy = execution.second.lock())
+      {
+        // A copy which is pending is aborted when its process starts.
+        copy->m_AsyncAbortRequested = true;
+        copy->Abort();
+      }
+    }
+  }
+}
+
+
+void
+ProcessObject::SetExecutionTimeout(double seconds)
+{
+  this->m_ExecutionTimeout = std::max(seconds, 0.0);
+}
+
+
+double
+ProcessObject::GetExecutionTimeout() const
+{
+  return this->m_ExecutionTimeout;
+}
+
+
+bool
+ProcessObject::IsExecutionTimeoutExpired()
+{
+  if (!this->m_ExecutionTimedOut && this->m_ExecutionTimeout > 0.0 &&
+      GetExecutionTraceTime() > this->m_ExecutionPreUpdateTime + this->m_ExecutionTimeout)
+  {
+    this->m_ExecutionTimedOut = true;
+  }
+  return this->m_ExecutionTimedOut;
+}
+
+
+void
+ProcessObject::CheckExecutionTimeout()
+{
+  if (this->IsExecutionTimeoutExpired())
+  {
+    this->ThrowExecutionTimeout();
+  }
+}
+
+
+void
+ProcessObject::UpdateWithTimeout(itk::ProcessObject * p)
+{
+  assert(p);
+
+  // The TimeoutException is not thrown from an observer, so ITK
+  // resets the pipeline of the aborted process before it is thrown.
+  try
+  {
+    p->Update();
+  }
+  catch (itk::ProcessAborted &)
+  {
+    if (this->m_ExecutionTimedOut)
+    {
+      this->ThrowExecutionTimeout();
+    }
+    throw;
+  }
+
+  if (this->m_ExecutionTimedOut)
+  {
+    this->ThrowExecutionTimeout();
+  }
+}
+
+
+void
+ProcessObject::ThrowExecutionTimeout()
+{
+  const double elapsedTime = GetExecutionTraceTime() - this->m_ExecutionPreUpdateTime;
+  const float progress = this->m_ActiveProcess ? this->m_ActiveProcess->GetProgress() : this->m_ProgressMeasurement;
+
+  std::ostringstream message;
+  message << "sitk::ERROR: The execution of \"" << this->GetName() << "\" exceeded the timeout of "
+          << this->m_ExecutionTimeout << " seconds, and was aborted after " << elapsedTime
+          << " seconds at progress " << progress << ".";
+  throw TimeoutException(__FILE__, __LINE__, message.str(), progress, elapsedTime);
 }
 
 
@@ -482,6 +959,9 @@ ProcessObject::PreUpdate(itk::ProcessObject * p)
 
   p->GetMultiThreader()->SetMaximumNumberOfThreads(this->GetNumberOfThreads());
 
+  this->m_ExecutionPreUpdateTime = GetExecutionTraceTime();
+  this->m_ExecutionEndWallTime = 0.0;
+
   try
   {
     this->m_ActiveProcess = p;
@@ -489,11 +969,31 @@ ProcessObject::PreUpdate(itk::ProcessObject * p)
     // add command on active process deletion
     p->AddObserver(eventDeleteEvent, [this](const itk::EventObject &) { this->OnActiveProcessDelete(); });
 
+    // measure the execution of the active process
+    p->AddObserver(eventStartEvent, [this](const itk::EventObject &) { this->OnActiveProcessStart(); });
+    p->AddObserver(eventEndEvent, [this](const itk::EventObject &) { this->OnActiveProcessEnd(); });
+
     // register commands
     for (auto & eventCommand : m_Commands)
     {
       this->AddObserverToActiveProcessObject(eventCommand);
     }
+
+    // after the commands, replace the exception of an execution
+    // aborted by the watchdog
+    this->m_ExecutionTimedOut = false;
+    if (this->m_ExecutionTimeout > 0.0 || this->m_AsyncExecutionCopy)
+    {
+      // The deadline, and an abort forwarded to an asynchronous
+      // execution, are also checked at progress in the thread of the
+      // execution, as the abort flag is reset when the process starts.
+      p->AddObserver(eventProgressEvent, [this](const itk::EventObject &) {
+        if (this->m_AsyncAbortRequested || this->IsExecutionTimeoutExpired())
+        {
+          this->Abort();
+        }
+      });
+    }
   }
   catch (...)
   {
@@ -505,6 +1005,53 @@ ProcessObject::PreUpdate(itk::ProcessObject * p)
 }
 
 
+void
+ProcessObject::PreUpdateDeferred(itk::ProcessObject * p, Image & output)
+{
+  assert(p);
+
+  // propagate number of threads
+  if (this->GetNumberOfWorkUnits() != 0)
+  {
+    p->SetNumberOfWorkUnits(this->GetNumberOfWorkUnits());
+  }
+
+  p->GetMultiThreader()->SetMaximumNumberOfThreads(this->GetNumberOfThreads());
+
+  // The data of the output is released after it is used by a
+  // following filter of the pipeline, it is kept when the output is
+  // updated as a SimpleITK image.
+  p->GetPrimaryOutput()->ReleaseDataFlagOn();
+
+  // The ITK outputs only have a weak reference to their source, so
+  // the image holds all the filters of the pipeline which are not
+  // yet updated.
+  std::vector<itk::ProcessObject *> pipeline;
+  std::vector<itk::ProcessObject *> pending{ p };
+  while (!pending.empty())
+  {
+    itk::ProcessObject * current = pending.back();
+    pending.pop_back();
+    if (std::find(pipeline.begin(), pipeline.end(), current) != pipeline.end())
+    {
+      continue;
+    }
+    pipeline.push_back(current);
+
+    for (const auto & input : current->GetInputs())
+    {
+      if (input && input->GetSource())
+      {
+        pending.push_back(input->GetSource().GetPointer());
+      }
+    }
+  }
+  output.SetDeferredPipeline(pipeline);
+
+  sitkDebugMacro("Deferred execution of ITK filter:\n" << *p);
+}
+
+
 unsigned long
 ProcessObject::AddITKObserver(const itk::EventObject & e, itk::Command * c)
 {
@@ -564,6 +1111,27 @@ ProcessObject::GetActiveProcess()
 void
 ProcessObject::OnActiveProcessDelete()
 {
+  GetExecutionWatchdog().Remove(this);
+
+  if (this->m_ActiveProcess && IsExecutionTraceEnabled())
+  {
+    // The ITK process is deleted when Execute returns, after the
+    // output has been converted.
+    try
+    {
+      const double now = GetExecutionTraceTime();
+      if (this->m_ExecutionEndWallTime > 0.0)
+      {
+        AddExecutionTraceEvent("OutputConversion", "SimpleITK", this->m_ExecutionEndWallTime, now);
+      }
+      AddExecutionTraceEvent(this->GetName(), "Execute", this->m_ExecutionPreUpdateTime, now);
+    }
+    catch (...)
+    {
+      // the trace is best effort
+    }
+  }
+
   if (this->m_ActiveProcess)
   {
     this->m_ProgressMeasurement = this->m_ActiveProcess->GetProgress();
@@ -583,6 +1151,313 @@ ProcessObject::OnActiveProcessDelete()
 }
 
 
+void
+ProcessObject::OnActiveProcessStart()
+{
+  if (!this->m_ActiveProcess)
+  {
+    return;
+  }
+
+  ExecutionStatistics & stats = this->m_ActiveExecutionStatistics;
+  stats = ExecutionStatistics();
+  stats.Name = this->GetName();
+  stats.NumberOfThreads = this->m_ActiveProcess->GetMultiThreader()->GetMaximumNumberOfThreads();
+  stats.NumberOfWorkUnits = this->m_ActiveProcess->GetNumberOfWorkUnits();
+
+  this->m_ExecutionInputBuffers.clear();
+  for (const auto & input : this->m_ActiveProcess->GetInputs())
+  {
+    const PixelBufferType buffer = GetPixelBuffer(input.GetPointer());
+    if (buffer.first != nullptr)
+    {
+      this->m_ExecutionInputBuffers.push_back(buffer.first);
+      stats.InputBytes += buffer.second;
+    }
+  }
+
+  this->m_ExecutionStartWallTime = GetExecutionTraceTime();
+  this->m_ExecutionStartCPUTime = GetCPUClockSeconds();
+
+  if (this->m_ExecutionTimeout > 0.0)
+  {
+    GetExecutionWatchdog().Add(this, this->m_ExecutionPreUpdateTime + this->m_ExecutionTimeout, [this] {
+      this->m_ExecutionTimedOut = true;
+      this->Abort();
+    });
+  }
+}
+
+
+void
+ProcessObject::OnActiveProcessEnd()
+{
+  if (!this->m_ActiveProcess)
+  {
+    return;
+  }
+
+  GetExecutionWatchdog().Remove(this);
+
+  ExecutionStatistics & stats = this->m_ActiveExecutionStatistics;
+  stats.WallTime = GetExecutionTraceTime() - this->m_ExecutionStartWallTime;
+  stats.CPUTime = GetCPUClockSeconds() - this->m_ExecutionStartCPUTime;
+
+  for (const auto & output : this->m_ActiveProcess->GetOutputs())
+  {
+    const PixelBufferType buffer = GetPixelBuffer(output.GetPointer());
+    if (buffer.first == nullptr)
+    {
+      continue;
+    }
+    stats.OutputBytes += buffer.second;
+
+    // buffers of the input are reused by in-place filters
+    if (std::find(m_ExecutionInputBuffers.begin(), m_ExecutionInputBuffers.end(), buffer.first) ==
+        m_ExecutionInputBuffers.end())
+    {
+      stats.AllocatedBytes += buffer.second;
+    }
+  }
+  this->m_ExecutionInputBuffers.clear();
+  this->m_ExecutionEndWallTime = this->m_ExecutionStartWallTime + stats.WallTime;
+
+  this->m_LastExecutionStatistics = stats;
+  AddGlobalExecutionStatistics(stats);
+
+  if (IsExecutionTraceEnabled())
+  {
+    AddExecutionTraceEvent("Update",
+                           "ITK",
+                           this->m_ExecutionStartWallTime,
+                           this->m_ExecutionEndWallTime,
+                           { { "Name", stats.Name },
+                             { "NumberOfThreads", std::to_string(stats.NumberOfThreads) },
+                             { "NumberOfWorkUnits", std::to_string(stats.NumberOfWorkUnits) },
+                             { "InputBytes", std::to_string(stats.InputBytes) },
+                             { "OutputBytes", std::to_string(stats.OutputBytes) } });
+  }
+}
+
+
+ExecutionStatistics
+ProcessObject::GetLastExecutionStatistics() const
+{
+  return this->m_LastExecutionStatistics;
+}
+
+
+std::vector<ExecutionStatisticsSummary>
+ProcessObject::GetGlobalExecutionStatistics()
+{
+  std::vector<ExecutionStatisticsSummary> summaries;
+  {
+    GlobalExecutionStatistics & global = GetGlobalExecutionStatisticsInstance();
+    std::lock_guard<std::mutex> lock(global.m_Mutex);
+    for (const auto & nameSummary : global.m_Summaries)
+    {
+      summaries.push_back(nameSummary.second);
+    }
+  }
+
+  std::stable_sort(summaries.begin(),
+                   summaries.end(),
+                   [](const ExecutionStatisticsSummary & a, const ExecutionStatisticsSummary & b) {
+                     return a.TotalWallTime > b.TotalWallTime;
+                   });
+  return summaries;
+}
+
+
+void
+ProcessObject::SetGlobalAsyncConcurrency(unsigned int n)
+{
+  GetAsyncExecutor().SetConcurrency(n);
+}
+
+
+unsigned int
+ProcessObject::GetGlobalAsyncConcurrency()
+{
+  return GetAsyncExecutor().GetConcurrency();
+}
+
+
+void
+ProcessObject::EnqueueAsyncTask(std::function<void()> task)
+{
+  GetAsyncExecutor().Enqueue(std::move(task));
+}
+
+
+std::shared_ptr<ProcessObject::AsyncExecutionState>
+ProcessObject::PrepareAsyncExecution(const std::shared_ptr<ProcessObject> & copy)
+{
+  assert(copy && copy.get() != this);
+
+  for (const auto & eventCommand : this->m_Commands)
+  {
+    copy->AddCommand(eventCommand.m_Event, *eventCommand.m_Command);
+  }
+  copy->m_AsyncExecutionCopy = true;
+
+  if (!this->m_AsyncExecutionState)
+  {
+    this->m_AsyncExecutionState = std::make_shared<AsyncExecutionState>();
+    this->m_AsyncExecutionState->Owner = this;
+  }
+
+  std::lock_guard<std::mutex> lock(this->m_AsyncExecutionState->Mutex);
+  auto & executions = this->m_AsyncExecutionState->Executions;
+  executions.erase(std::remove_if(executions.begin(),
+                                  executions.end(),
+                                  [](const auto & execution) { return execution.second.expired(); }),
+                   executions.end());
+  executions.emplace_back(copy.get(), copy);
+  return this->m_AsyncExecutionState;
+}
+
+
+void
+ProcessObject::DetachAsyncExecutions()
+{
+  if (this->m_AsyncExecutionState)
+  {
+    std::lock_guard<std::mutex> lock(this->m_AsyncExecutionState->Mutex);
+    this->m_AsyncExecutionState->Owner = nullptr;
+  }
+}
+
+
+void
+ProcessObject::CompleteAsyncExecution(const std::shared_ptr<AsyncExecutionState> & state,
+                                      const ProcessObject *                        copy,
+                                      const std::function<void(ProcessObject &)> & update)
+{
+  std::lock_guard<std::mutex> lock(state->Mutex);
+  auto & executions = state->Executions;
+  executions.erase(std::remove_if(executions.begin(),
+                                  executions.end(),
+                                  [copy](const auto & execution) { return execution.first == copy; }),
+                   executions.end());
+
+  if (state->Owner && update)
+  {
+    update(*state->Owner);
+  }
+}
+
+
+void
+ProcessObject::ParallelizeBatch(size_t                              numberOfTasks,
+                                const std::function<void(size_t)> & task,
+                                unsigned int                        numberOfThreads,
+                                itk::ProcessObject *                filter)
+{
+  std::exception_ptr firstException;
+  std::mutex         exceptionMutex;
+
+  if (numberOfThreads == 0)
+  {
+    numberOfThreads = this->GetNumberOfThreads();
+  }
+
+  auto mt = itk::MultiThreaderBase::New();
+  mt->SetMaximumNumberOfThreads(numberOfThreads);
+  mt->SetNumberOfWorkUnits(mt->GetMaximumNumberOfThreads());
+  try
+  {
+    mt->ParallelizeArray(
+      0,
+      numberOfTasks,
+      [&task, &firstException, &exceptionMutex, filter](SizeValueType i) {
+        // the remaining tasks are skipped once the filter is aborted
+        if (filter != nullptr && filter->GetAbortGenerateData())
+        {
+          return;
+        }
+        try
+        {
+          task(i);
+        }
+        catch (...)
+        {
+          std::lock_guard<std::mutex> lock(exceptionMutex);
+          if (!firstException)
+          {
+            firstException = std::current_exception();
+          }
+        }
+      },
+      filter);
+  }
+  catch (itk::ProcessAborted &)
+  {
+    // handled below with the abort flag of the filter
+  }
+
+  if (filter != nullptr && filter->GetAbortGenerateData())
+  {
+    // As UpdateWithTimeout, a TimeoutException is thrown when the
+    // execution timed out, otherwise the ITK ProcessAborted exception.
+    filter->InvokeEvent(itk::AbortEvent());
+    if (this->m_ExecutionTimedOut)
+    {
+      this->ThrowExecutionTimeout();
+    }
+    throw itk::ProcessAborted(__FILE__, __LINE__);
+  }
+
+  if (firstException)
+  {
+    std::rethrow_exception(firstException);
+  }
+
+  if (filter != nullptr)
+  {
+    this->CheckExecutionTimeout();
+  }
+}
+
+
+Image
+ProcessObject::ExecuteWithResultCache(const std::function<std::string()> & parameters,
+                                      const std::vector<const Image *> &   inputs,
+                                      const std::function<Image()> &       execute)
+{
+  if (!IsResultCacheEnabled())
+  {
+    return execute();
+  }
+
+  const std::string key = ComputeResultCacheKey(parameters(), inputs);
+  if (key.empty())
+  {
+    return execute();
+  }
+
+  Image result;
+  if (FindResultCache(key, result))
+  {
+    sitkDebugMacro("Result cache hit: " << key);
+    return result;
+  }
+
+  result = execute();
+  AddResultCache(key, result);
+  return result;
+}
+
+
+void
+ProcessObject::ResetGlobalExecutionStatistics()
+{
+  GlobalExecutionStatistics & global = GetGlobalExecutionStatisticsInstance();
+  std::lock_guard<std::mutex> lock(global.m_Mutex);
+  global.m_Summaries.clear();
+}
+
+
 void
 ProcessObject::onCommandDelete(const itk::simple::Command * cmd) noexcept
 {
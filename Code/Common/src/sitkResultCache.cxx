@@ -0,0 +1,590 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#include "sitkResultCache.h"
+#include "sitkResultCacheInternal.h"
+#include "sitkPixelIDTypeLists.h"
+#include "sitkVersion.h"
+
+#include "Ancillary/hl_sha1.h"
+
+#include "itkMetaDataObject.h"
+#include "itksys/SystemInformation.hxx"
+#include "itksys/SystemTools.hxx"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <limits>
+#include <list>
+#include <mutex>
+#include <sstream>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+
+namespace itk::simple
+{
+
+namespace
+{
+
+const char * const ResultCacheFileMagic = "SimpleITKResultCache 2";
+
+struct ResultCacheEntry
+{
+  std::string Key;
+  Image       Result;
+  uint64_t    Bytes{ 0 };
+};
+
+struct ResultCache
+{
+  std::mutex m_Mutex;
+
+  uint64_t m_MaximumBytes{ 0 };
+  PathType m_Directory;
+
+  // Set with the mutex held, and read without it by every cacheable
+  // execution, so a disabled cache costs one atomic load.
+  std::atomic<bool> m_Enabled{ false };
+
+  // Update the enabled flag from the settings. The mutex must be held.
+  void
+  UpdateEnabled()
+  {
+    m_Enabled = m_MaximumBytes > 0 || !m_Directory.empty();
+  }
+
+  // the entries are ordered from the most to the least recently used
+  std::list<ResultCacheEntry>                                             m_Entries;
+  std::unordered_map<std::string, std::list<ResultCacheEntry>::iterator> m_Index;
+
+  ResultCacheStatistics m_Statistics;
+
+  // Remove the least recently used entries until the maximum size is
+  // satisfied. The mutex must be held.
+  void
+  Evict()
+  {
+    while (!m_Entries.empty() && m_Statistics.Bytes > m_MaximumBytes)
+    {
+      m_Statistics.Bytes -= m_Entries.back().Bytes;
+      m_Index.erase(m_Entries.back().Key);
+      m_Entries.pop_back();
+    }
+    m_Statistics.NumberOfImages = m_Entries.size();
+  }
+
+  // Add or refresh an entry in memory. The mutex must be held.
+  void
+  Insert(const std::string & key, const Image & result, uint64_t bytes)
+  {
+    if (m_MaximumBytes == 0 || bytes > m_MaximumBytes)
+    {
+      return;
+    }
+
+    auto it = m_Index.find(key);
+    if (it != m_Index.end())
+    {
+      m_Entries.splice(m_Entries.begin(), m_Entries, it->second);
+      return;
+    }
+
+    m_Entries.push_front(ResultCacheEntry{ key, result, bytes });
+    m_Index[key] = m_Entries.begin();
+    m_Statistics.Bytes += bytes;
+    this->Evict();
+  }
+};
+
+// The cache is never destroyed, so that stored images are not
+// released after the ITK libraries at exit.
+ResultCache &
+GetResultCache()
+{
+  static auto * cache = new ResultCache;
+  return *cache;
+}
+
+
+bool
+IsCacheableImage(const Image & image)
+{
+  return TypeListHasPixelIDValue<BasicPixelIDTypeList>(image.GetPixelID()) ||
+         TypeListHasPixelIDValue<VectorPixelIDTypeList>(image.GetPixelID());
+}
+
+uint64_t
+GetImageBufferBytes(const Image & image)
+{
+  return image.GetNumberOfPixels() * image.GetNumberOfComponentsPerPixel() * image.GetSizeOfPixelComponent();
+}
+
+// Map the name of a pixel type written to a cache file back to the
+// pixel ID of this build.
+PixelIDValueEnum
+GetCacheablePixelIDFromString(const std::string & name)
+{
+  const PixelIDValueEnum ids[] = { sitkUInt8,          sitkInt8,          sitkUInt16,        sitkInt16,
+                                   sitkUInt32,         sitkInt32,         sitkUInt64,        sitkInt64,
+                                   sitkFloat32,        sitkFloat64,       sitkComplexFloat32, sitkComplexFloat64,
+                                   sitkVectorUInt8,    sitkVectorInt8,    sitkVectorUInt16,  sitkVectorInt16,
+                                   sitkVectorUInt32,   sitkVectorInt32,   sitkVectorUInt64,  sitkVectorInt64,
+                                   sitkVectorFloat32,  sitkVectorFloat64 };
+  for (const PixelIDValueEnum id : ids)
+  {
+    if (id != sitkUnknown && GetPixelIDValueAsString(id) == name)
+    {
+      return id;
+    }
+  }
+  return sitkUnknown;
+}
+
+
+class SHA1Hasher
+{
+public:
+  SHA1Hasher() { m_SHA1.SHA1Reset(&m_Context); }
+
+  void
+  Append(const void * data, uint64_t length)
+  {
+    // the length of each input to the hash is limited to an unsigned int
+    constexpr uint64_t chunkSize = 1u << 30;
+    const auto *       bytes = static_cast<const hl_uint8 *>(data);
+    while (length > 0)
+    {
+      const uint64_t n = std::min(length, chunkSize);
+      m_SHA1.SHA1Input(&m_Context, bytes, static_cast<unsigned int>(n));
+      bytes += n;
+      length -= n;
+    }
+  }
+
+  void
+  Append(const std::string & s)
+  {
+    // include the length so that consecutive strings are not ambiguous
+    const uint64_t length = s.size();
+    this->Append(&length, sizeof(length));
+    this->Append(s.data(), length);
+  }
+
+  template <typename T>
+  void
+  Append(const std::vector<T> & v)
+  {
+    const uint64_t length = v.size();
+    this->Append(&length, sizeof(length));
+    this->Append(v.data(), length * sizeof(T));
+  }
+
+  std::string
+  GetHexDigest()
+  {
+    hl_uint8 digest[SHA1HashSize];
+    m_SHA1.SHA1Result(&m_Context, digest);
+
+    std::ostringstream os;
+    for (const hl_uint8 d : digest)
+    {
+      os << std::hex << std::setw(2) << std::setfill('0') << static_cast<unsigned int>(d);
+    }
+    return os.str();
+  }
+
+private:
+  ::SHA1       m_SHA1;
+  HL_SHA1_CTX m_Context;
+};
+
+
+PathType
+GetResultCacheFileName(const PathType & directory, const std::string & key)
+{
+  return directory + "/" + key + ".sitkcache";
+}
+
+template <typename T>
+void
+WriteVector(std::ostream & out, const char * name, const std::vector<T> & v)
+{
+  out << name;
+  for (const T & value : v)
+  {
+    out << ' ' << value;
+  }
+  out << '\n';
+}
+
+template <typename T>
+bool
+ReadVector(std::istream & in, const char * name, unsigned int length, std::vector<T> & v)
+{
+  std::string line;
+  if (!std::getline(in, line))
+  {
+    return false;
+  }
+  std::istringstream ls(line);
+  std::string        token;
+  ls >> token;
+  v.resize(length);
+  for (T & value : v)
+  {
+    ls >> value;
+  }
+  return token == name && !ls.fail();
+}
+
+
+// Strings are written prefixed with their length, so they may contain any character.
+void
+WriteCacheString(std::ostream & out, const std::string & s)
+{
+  out << s.size() << ':' << s;
+}
+
+bool
+ReadCacheString(std::istream & in, std::string & s)
+{
+  size_t length = 0;
+  if (!(in >> length) || in.get() != ':')
+  {
+    return false;
+  }
+  s.resize(length);
+  return length == 0 || static_cast<bool>(in.read(&s[0], static_cast<std::streamsize>(length)));
+}
+
+// The meta-data dictionary of the result is stored with the pixels,
+// so a result read from the directory is the same as a result found
+// in memory. Only string values are written, a result with other
+// values is not stored in the directory.
+bool
+GetStringMetaData(const Image & image, std::vector<std::pair<std::string, std::string>> & metaData)
+{
+  const itk::MetaDataDictionary & dictionary = image.GetITKBase()->GetMetaDataDictionary();
+  for (const auto & entry : dictionary)
+  {
+    const auto * value = dynamic_cast<const itk::MetaDataObject<std::string> *>(entry.second.GetPointer());
+    if (value == nullptr)
+    {
+      return false;
+    }
+    metaData.emplace_back(entry.first, value->GetMetaDataObjectValue());
+  }
+  return true;
+}
+
+
+// Write the result to the directory. A temporary file is renamed,
+// so concurrent readers never see a partial file.
+void
+WriteResultCacheFile(const PathType & directory, const std::string & key, const Image & result)
+{
+  std::vector<std::pair<std::string, std::string>> metaData;
+  if (!GetStringMetaData(result, metaData) || !itksys::SystemTools::MakeDirectory(directory))
+  {
+    return;
+  }
+
+  itksys::SystemInformation info;
+  std::ostringstream        tmpName;
+  tmpName << GetResultCacheFileName(directory, key) << ".tmp" << info.GetProcessId() << '_'
+          << std::hash<std::thread::id>{}(std::this_thread::get_id());
+
+  {
+    std::ofstream out(tmpName.str().c_str(), std::ios::binary);
+    out << std::setprecision(std::numeric_limits<double>::max_digits10);
+    out << ResultCacheFileMagic << '\n';
+    out << GetPixelIDValueAsString(result.GetPixelID()) << '\n';
+    out << result.GetDimension() << ' ' << result.GetNumberOfComponentsPerPixel() << '\n';
+    WriteVector(out, "Size", result.GetSize());
+    WriteVector(out, "Origin", result.GetOrigin());
+    WriteVector(out, "Spacing", result.GetSpacing());
+    WriteVector(out, "Direction", result.GetDirection());
+    out << "MetaData " << metaData.size() << '\n';
+    for (const auto & keyValue : metaData)
+    {
+      WriteCacheString(out, keyValue.first);
+      WriteCacheString(out, keyValue.second);
+      out << '\n';
+    }
+
+    const auto * buffer = static_cast<const char *>(result.GetBufferAsVoid());
+    out.write(buffer, static_cast<std::streamsize>(GetImageBufferBytes(result)));
+    if (!out)
+    {
+      out.close();
+      std::remove(tmpName.str().c_str());
+      return;
+    }
+  }
+
+  if (std::rename(tmpName.str().c_str(), GetResultCacheFileName(directory, key).c_str()) != 0)
+  {
+    std::remove(tmpName.str().c_str());
+  }
+}
+
+
+bool
+ReadResultCacheFile(const PathType & directory, const std::string & key, Image & result)
+{
+  std::ifstream in(GetResultCacheFileName(directory, key).c_str(), std::ios::binary);
+  if (!in)
+  {
+    return false;
+  }
+
+  std::string magic;
+  std::string pixelName;
+  if (!std::getline(in, magic) || magic != ResultCacheFileMagic || !std::getline(in, pixelName))
+  {
+    return false;
+  }
+
+  const PixelIDValueEnum pixelID = GetCacheablePixelIDFromString(pixelName);
+  unsigned int           dimension = 0;
+  unsigned int           numberOfComponents = 0;
+  std::string            line;
+  if (pixelID == sitkUnknown || !std::getline(in, line) ||
+      !(std::istringstream(line) >> dimension >> numberOfComponents) || dimension < 2 ||
+      dimension > SITK_MAX_DIMENSION)
+  {
+    return false;
+  }
+
+  std::vector<unsigned int> size;
+  std::vector<double>       origin;
+  std::vector<double>       spacing;
+  std::vector<double>       direction;
+  if (!ReadVector(in, "Size", dimension, size) || !ReadVector(in, "Origin", dimension, origin) ||
+      !ReadVector(in, "Spacing", dimension, spacing) || !ReadVector(in, "Direction", dimension * dimension, direction))
+  {
+    return false;
+  }
+
+  std::string metaDataToken;
+  size_t      numberOfMetaData = 0;
+  if (!(in >> metaDataToken >> numberOfMetaData) || metaDataToken != "MetaData" || in.get() != '\n')
+  {
+    return false;
+  }
+  std::vector<std::pair<std::string, std::string>> metaData(numberOfMetaData);
+  for (auto & keyValue : metaData)
+  {
+    if (!ReadCacheString(in, keyValue.first) || !ReadCacheString(in, keyValue.second) || in.get() != '\n')
+    {
+      return false;
+    }
+  }
+
+  // every pixel is read below
+  Image image = Image::CreateUninitialized(size, pixelID, numberOfComponents);
+  image.SetOrigin(origin);
+  image.SetSpacing(spacing);
+  image.SetDirection(direction);
+  for (const auto & keyValue : metaData)
+  {
+    image.SetMetaData(keyValue.first, keyValue.second);
+  }
+
+  const std::streamsize bytes = static_cast<std::streamsize>(GetImageBufferBytes(image));
+  in.read(static_cast<char *>(image.GetBufferAsVoid()), bytes);
+  if (in.gcount() != bytes)
+  {
+    return false;
+  }
+
+  result = std::move(image);
+  return true;
+}
+
+} // namespace
+
+
+void
+SetResultCacheMaximumBytes(uint64_t numberOfBytes)
+{
+  ResultCache &               cache = GetResultCache();
+  std::lock_guard<std::mutex> lock(cache.m_Mutex);
+  cache.m_MaximumBytes = numberOfBytes;
+  cache.UpdateEnabled();
+  cache.Evict();
+}
+
+uint64_t
+GetResultCacheMaximumBytes()
+{
+  ResultCache &               cache = GetResultCache();
+  std::lock_guard<std::mutex> lock(cache.m_Mutex);
+  return cache.m_MaximumBytes;
+}
+
+void
+SetResultCacheDirectory(const PathType & directory)
+{
+  ResultCache &               cache = GetResultCache();
+  std::lock_guard<std::mutex> lock(cache.m_Mutex);
+  cache.m_Directory = directory;
+  cache.UpdateEnabled();
+}
+
+PathType
+GetResultCacheDirectory()
+{
+  ResultCache &               cache = GetResultCache();
+  std::lock_guard<std::mutex> lock(cache.m_Mutex);
+  return cache.m_Directory;
+}
+
+void
+ClearResultCache()
+{
+  ResultCache & cache = GetResultCache();
+
+  // release the images after the lock
+  std::list<ResultCacheEntry> entries;
+  {
+    std::lock_guard<std::mutex> lock(cache.m_Mutex);
+    entries.swap(cache.m_Entries);
+    cache.m_Index.clear();
+    cache.m_Statistics = ResultCacheStatistics();
+  }
+}
+
+ResultCacheStatistics
+GetResultCacheStatistics()
+{
+  ResultCache &               cache = GetResultCache();
+  std::lock_guard<std::mutex> lock(cache.m_Mutex);
+  return cache.m_Statistics;
+}
+
+
+bool
+IsResultCacheEnabled()
+{
+  return GetResultCache().m_Enabled;
+}
+
+
+std::string
+ComputeResultCacheKey(const std::string & parameters, const std::vector<const Image *> & inputs)
+{
+  SHA1Hasher hasher;
+
+  // The results stored in the cache directory may be read by other
+  // versions, whose filters may compute different results.
+  hasher.Append(Version::VersionString());
+  hasher.Append(Version::ITKVersionString());
+  hasher.Append(parameters);
+
+  for (const Image * image : inputs)
+  {
+    if (image == nullptr)
+    {
+      hasher.Append(std::string("null"));
+      continue;
+    }
+
+    if (!IsCacheableImage(*image))
+    {
+      return std::string();
+    }
+
+    // The pixel type is hashed by name, which does not depend on the
+    // pixel types instantiated in the build.
+    hasher.Append(GetPixelIDValueAsString(image->GetPixelID()));
+    const uint64_t numberOfComponents = image->GetNumberOfComponentsPerPixel();
+    hasher.Append(&numberOfComponents, sizeof(numberOfComponents));
+    hasher.Append(image->GetSize());
+    hasher.Append(image->GetOrigin());
+    hasher.Append(image->GetSpacing());
+    hasher.Append(image->GetDirection());
+    hasher.Append(image->GetBufferAsVoid(), GetImageBufferBytes(*image));
+  }
+
+  return hasher.GetHexDigest();
+}
+
+
+bool
+FindResultCache(const std::string & key, Image & result)
+{
+  ResultCache & cache = GetResultCache();
+  PathType      directory;
+  {
+    std::lock_guard<std::mutex> lock(cache.m_Mutex);
+    auto                        it = cache.m_Index.find(key);
+    if (it != cache.m_Index.end())
+    {
+      cache.m_Entries.splice(cache.m_Entries.begin(), cache.m_Entries, it->second);
+      result = it->second->Result;
+      ++cache.m_Statistics.NumberOfHits;
+      return true;
+    }
+    directory = cache.m_Directory;
+  }
+
+  Image image;
+  if (!directory.empty() && ReadResultCacheFile(directory, key, image))
+  {
+    std::lock_guard<std::mutex> lock(cache.m_Mutex);
+    cache.Insert(key, image, GetImageBufferBytes(image));
+    ++cache.m_Statistics.NumberOfDiskHits;
+    result = std::move(image);
+    return true;
+  }
+
+  std::lock_guard<std::mutex> lock(cache.m_Mutex);
+  ++cache.m_Statistics.NumberOfMisses;
+  return false;
+}
+
+
+void
+AddResultCache(const std::string & key, const Image & result)
+{
+  if (!IsCacheableImage(result))
+  {
+    return;
+  }
+
+  ResultCache & cache = GetResultCache();
+  PathType      directory;
+  {
+    std::lock_guard<std::mutex> lock(cache.m_Mutex);
+    cache.Insert(key, result, GetImageBufferBytes(result));
+    directory = cache.m_Directory;
+  }
+
+  if (!directory.empty())
+  {
+    WriteResultCacheFile(directory, key, result);
+  }
+}
+
+} // namespace itk::simple
@@ -0,0 +1,54 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef sitkResultCacheInternal_h
+#define sitkResultCacheInternal_h
+
+#include "sitkCommon.h"
+#include "sitkImage.h"
+
+#include <string>
+#include <vector>
+
+namespace itk::simple
+{
+
+/** Query if the memory cache or the disk store is enabled. */
+SITKCommon_HIDDEN bool
+IsResultCacheEnabled();
+
+/** Compute the key of an execution from the serialized parameters of
+ * the filter, its input images and the SimpleITK and ITK versions. A
+ * null input is an omitted optional input.
+ *
+ * An empty string is returned if an input can not be hashed.
+ */
+SITKCommon_HIDDEN std::string
+ComputeResultCacheKey(const std::string & parameters, const std::vector<const Image *> & inputs);
+
+/** Find the result for a key in memory, then in the cache
+ * directory. Returns true and sets result on a hit. */
+SITKCommon_HIDDEN bool
+FindResultCache(const std::string & key, Image & result);
+
+/** Store a result for the key in memory and in the cache directory. */
+SITKCommon_HIDDEN void
+AddResultCache(const std::string & key, const Image & result);
+
+} // namespace itk::simple
+
+#endif
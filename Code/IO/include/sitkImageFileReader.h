@@ -23,6 +23,9 @@
 #include "sitkImageReaderBase.h"
 #include "sitkMemberFunctionFactory.h"
 
+#include <map>
+#include <memory>
+
 
 namespace itk
 {
@@ -32,6 +35,11 @@ class MetaDataDictionary;
 namespace simple
 {
 
+namespace ioutils
+{
+class HeaderCache;
+}
+
 /** \class ImageFileReader
  * \brief Read an image file and return a SimpleITK Image.
  *
@@ -57,6 +65,11 @@ namespace simple
  * when multiple ImageIOs "can read" the file and the user wants
  * to select a specific IO (not the first).
  *
+ * With deferred execution enabled, the bulk data is read when the
+ * returned image is accessed. An ImageFileWriter with a number of
+ * stream divisions reads the data in divisions when the ImageIO
+ * supports streamed reading.
+ *
  * \note DICOM tags are represented as strings in the meta-data
  * dictionary(s), therefore "0020|000D" and "0020|000d" are
  * different when accessing the tag value. This differs from
@@ -218,6 +231,66 @@ public:
   const std::vector<int> &
   GetExtractIndex() const;
 
+  /** \brief Enable memory mapping the pixel data from the file.
+   *
+   * When enabled and the file's pixel data is stored contiguously,
+   * uncompressed and in the native byte order, the returned image's
+   * buffer is a private memory mapping of the file instead of being
+   * read into newly allocated memory. The pixels are then loaded
+   * from disk on demand by the operating system, and the page cache
+   * is shared between processes mapping the same file.
+   *
+   * The mapping is copy on write, modifications to the image are
+   * never written to the file. The file must not be truncated or
+   * overwritten while the image or a copy of it exists.
+   *
+   * Currently MetaImage (mha, mhd) files and NRRD files with a scalar
+   * pixel type and raw encoding are supported. If the file can not be
+   * mapped, the output pixel type differs from the file's or an
+   * extraction region is set, then the image is read normally.
+   *
+   * By default memory mapping is disabled.
+   * @{
+   */
+  void
+  SetUseMemoryMapping(bool useMemoryMapping);
+  bool
+  GetUseMemoryMapping() const;
+  void
+  UseMemoryMappingOn()
+  {
+    this->SetUseMemoryMapping(true);
+  }
+  void
+  UseMemoryMappingOff()
+  {
+    this->SetUseMemoryMapping(false);
+  }
+  /** @} */
+
+  /** \brief File used to cache the image information between runs.
+   *
+   * When set, ReadImageInformation first looks up the image file in
+   * this cache. If the size and the modification time of the image
+   * file are unchanged since the information was cached, then the
+   * image information and the meta-data are restored from the cache
+   * without the ImageIO parsing the file's header. Otherwise the
+   * header is read and the cache is updated. The cache file is
+   * written when the reader is destroyed, and may be shared by
+   * multiple readers and ImageSeriesReader::ScanDICOMDirectory.
+   *
+   * The meta-data values restored from the cache are strings, as
+   * returned by GetMetaData.
+   *
+   * By default the file name is empty and no cache is used.
+   * @{
+   */
+  void
+  SetHeaderCacheFileName(const PathType & fileName);
+  const PathType &
+  GetHeaderCacheFileName() const;
+  /** @} */
+
 protected:
   template <class TImageType>
   Image
@@ -229,6 +302,18 @@ protected:
   void
   UpdateImageInformationFromImageIO(const itk::ImageIOBase * iobase);
 
+  /** Internal methods which restore this classes stored meta-data
+   * and image information from, or convert it to, the values of the
+   * header cache.
+   */
+  bool
+  UpdateImageInformationFromHeaderCache(const std::map<std::string, std::string> & values);
+  std::map<std::string, std::string>
+  GetImageInformationForHeaderCache() const;
+
+  void
+  UpdateMetaDataDictionary(const MetaDataDictionary & metaDataDictionary);
+
 private:
   // Internal method used implements extracting a region from the reader
   template <class TImageType, class TInternalImageType>
@@ -263,6 +348,11 @@ private:
 
   std::vector<unsigned int> m_ExtractSize;
   std::vector<int>          m_ExtractIndex;
+
+  bool m_UseMemoryMapping{ false };
+
+  PathType                              m_HeaderCacheFileName;
+  std::shared_ptr<ioutils::HeaderCache> m_HeaderCache;
 };
 
 /**
@@ -46,6 +46,11 @@ namespace simple
  * location specified in FileName. If writing fails, an ITK exception is
  * thrown.
  *
+ * When the number of stream divisions is greater than one, the image
+ * is written in divisions if the ImageIO supports streamed writing,
+ * and an image of a deferred execution is updated one division at a
+ * time.
+ *
  * \sa itk::simple::WriteImage for the procedural interface
  */
 class SITKIO_EXPORT ImageFileWriter : public ProcessObject
@@ -24,9 +24,25 @@
 #include "sitkMemberFunctionFactory.h"
 #include "sitkProcessObjectDeleter.h"
 
+#include <map>
+
 namespace itk::simple
 {
 
+/** \brief The files of a DICOM series found by
+ * ImageSeriesReader::ScanDICOMDirectory.
+ *
+ * The file names are sorted in the same order as
+ * ImageSeriesReader::GetGDCMSeriesFileNames. Each element of MetaData
+ * holds the requested tags of the corresponding file, with the tags as
+ * keys in the "gggg|eeee" format of the meta-data dictionary.
+ */
+struct DICOMSeries
+{
+  std::vector<PathType>                           FileNames;
+  std::vector<std::map<std::string, std::string>> MetaData;
+};
+
 /** \class ImageSeriesReader
  * \brief Read series of image files into a SimpleITK image.
  *
@@ -164,6 +180,34 @@ public:
   static std::vector<std::string>
   GetGDCMSeriesIDs(const PathType & directory, bool useSeriesDetails = false);
 
+  /** \brief Index all the DICOM series of a directory in a single pass.
+   *
+   * Unlike calling GetGDCMSeriesIDs then GetGDCMSeriesFileNames for
+   * each series, which parses every file of the directory each time,
+   * the headers of the files are parsed once and concurrently. The
+   * parsing of each file stops before the pixel data, and files which
+   * are not DICOM are skipped.
+   *
+   * \param directory  The directory that contains the DICOM data set.
+   * \param tags       The tags to return for each file, such as "0008|0060".
+   * \param recursive  Recursively parse the input directory.
+   * \param headerCacheFileName  If not empty, the file used to cache the
+   * parsed headers between calls. Only the files added or modified
+   * since they were cached are parsed.
+   *
+   * Returns the series by their Series Instance UID, as returned by
+   * GetGDCMSeriesIDs without the useSeriesDetails.
+   *
+   * \sa GetGDCMSeriesIDs
+   * \sa GetGDCMSeriesFileNames
+   * \sa ImageFileReader::SetHeaderCacheFileName
+   **/
+  static std::map<std::string, DICOMSeries>
+  ScanDICOMDirectory(const PathType &                 directory,
+                     const std::vector<std::string> & tags = std::vector<std::string>(),
+                     bool                             recursive = false,
+                     const PathType &                 headerCacheFileName = "");
+
   void
   SetFileNames(const std::vector<PathType> & fileNames);
   const std::vector<PathType> &
@@ -202,6 +246,62 @@ public:
   void
   ReverseOrderOff();
 
+  /** \brief size of the region to extract from the series.
+   *
+   * By default the reader loads all the files of the series, this
+   * is specified when the size has zero length.
+   *
+   * If specified, then the image returned from `Execute` will be
+   * of this size. Only the files intersecting the extraction region
+   * along the slice dimension are read, and if the ImageIO and the
+   * files support reading just a region, then only the requested
+   * in-plane region of each file is read.
+   *
+   * The dimension of the image can be reduced by specifying a
+   * dimension's size as 0. For example a size of $[10,20,0]$
+   * results in a 2D image of a single slice. If the length of the
+   * specified size is greater than the dimension of the series, an
+   * exception will be generated. If the size's length is less than
+   * the series' dimension then the missing values are assumed to
+   * be zero.
+   *
+   * The extraction is performed by the sequential reader, the
+   * NumberOfReadThreads is not used.
+   *
+   * \sa ImageFileReader::SetExtractSize
+   * \sa ExtractImageFilter
+   */
+  void
+  SetExtractSize(const std::vector<unsigned int> & size);
+  const std::vector<unsigned int> &
+  GetExtractSize() const;
+
+  /** \brief starting index of the region to extract from the series.
+   *
+   * Missing dimensions are treated the same as 0.
+   *
+   * \sa ExtractImageFilter
+   */
+  void
+  SetExtractIndex(const std::vector<int> & index);
+  const std::vector<int> &
+  GetExtractIndex() const;
+
+  /** Set/Get the number of threads used to read the files of the series.
+   *
+   * With more than one thread, the files are read and decoded
+   * concurrently, each directly into its slab of the output
+   * image's buffer. The ordering of the slices, the spacing
+   * warning and the meta-data dictionary array are the same as
+   * when reading sequentially. A value of zero uses the number of
+   * threads of this process object. The default value of 1 reads
+   * the files sequentially.
+   */
+  void
+  SetNumberOfReadThreads(unsigned int numberOfReadThreads);
+  unsigned int
+  GetNumberOfReadThreads() const;
+
   Image
   Execute() override;
 
@@ -251,11 +351,27 @@ public:
 protected:
   template <class TImageType>
   Image
-  ExecuteInternal(itk::ImageIOBase *);
+  ExecuteInternal(itk::ImageIOBase *, unsigned int seriesDimension);
+
+  template <class TImageType, unsigned int VSeriesDimension>
+  Image
+  ExecuteExtract(itk::ImageIOBase *, unsigned int seriesDimension);
+
+  template <class TImageType>
+  Image
+  ExecuteInternalParallel(itk::ImageIOBase *, const TImageType * info, itk::ProcessObject * reader);
 
 private:
+  template <class TReader>
+  void
+  ConfigureReader(TReader * reader, itk::ImageIOBase *);
+
+  template <class TReader>
+  void
+  SetMetaDataDictionaryArrayAccess(TReader * reader);
+
   // function pointer type
-  typedef Image (Self::*MemberFunctionType)(itk::ImageIOBase *);
+  typedef Image (Self::*MemberFunctionType)(itk::ImageIOBase *, unsigned int);
 
   // friend to get access to executeInternal member
   friend struct detail::MemberFunctionAddressor<MemberFunctionType>;
@@ -280,6 +396,11 @@ private:
   bool m_ForceOrthogonalDirection{ true };
 
   bool m_ReverseOrder{ false };
+
+  unsigned int m_NumberOfReadThreads{ 1 };
+
+  std::vector<unsigned int> m_ExtractSize;
+  std::vector<int>          m_ExtractIndex;
 };
 
 /**
@@ -150,6 +150,20 @@ public:
   GetFileNames() const;
   /** @} */
 
+  /** Set/Get the number of threads used to write the slices.
+   *
+   * With more than one thread, the slices are encoded and written
+   * concurrently, each with its own ImageIO configured with the
+   * compressor and compression level. A value of zero uses the
+   * number of threads of this process object. The default value of
+   * 1 writes the slices sequentially.
+   * @{ */
+  void
+  SetNumberOfWriteThreads(unsigned int numberOfWriteThreads);
+  unsigned int
+  GetNumberOfWriteThreads() const;
+  /** @} */
+
 
   void
   Execute(const Image &);
@@ -161,6 +175,10 @@ protected:
   void
   ExecuteInternal(const Image & inImage);
 
+  template <class TImageType>
+  void
+  ExecuteInternalParallel(const TImageType * image, ImageIOBase * imageio, itk::ProcessObject * writer);
+
 private:
   itk::SmartPointer<ImageIOBase>
   GetImageIOBase(const PathType & fileName);
@@ -180,6 +198,8 @@ private:
   std::vector<PathType> m_FileNames;
 
   std::string m_ImageIOName;
+
+  unsigned int m_NumberOfWriteThreads{ 1 };
 };
 
 
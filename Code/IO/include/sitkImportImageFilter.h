@@ -23,6 +23,9 @@
 #include "sitkImageReaderBase.h"
 #include "sitkMemberFunctionFactory.h"
 
+#include <functional>
+#include <memory>
+
 namespace itk::simple
 {
 
@@ -37,6 +40,11 @@ namespace itk::simple
  * delete the buffer afterwards, and it buffer must remain valid
  * while in use.
  *
+ * Alternatively, the SetBufferAs methods accepting a BufferDeleterType
+ * transfer the ownership of the buffer. The image returned by Execute
+ * then owns the buffer and calls the deleter when the last image
+ * referencing it is destroyed.
+ *
  * \sa itk::simple::ImportAsInt8, itk::simple::ImportAsUInt8,
  * itk::simple::ImportAsInt16, itk::simple::ImportAsUInt16,
  * itk::simple::ImportAsInt32, itk::simple::ImportAsUInt32,
@@ -49,6 +57,9 @@ class SITKIO_EXPORT ImportImageFilter : public ImageReaderBase
 public:
   using Self = ImportImageFilter;
 
+  /** Function called with the buffer to release it. */
+  using BufferDeleterType = std::function<void(void *)>;
+
   ~ImportImageFilter() override;
 
   ImportImageFilter();
@@ -105,6 +116,37 @@ public:
   void
   SetBufferAsDouble(double * buffer, unsigned int numberOfComponents = 1);
 
+  /** \brief Set a buffer and transfer its ownership.
+   *
+   * The filter owns the buffer until it is passed to the image created
+   * by the next Execute, after which the filter no longer references
+   * the buffer. The deleter is called with the buffer once it is
+   * no longer referenced by the filter or any image. If the buffer
+   * is replaced before Execute, the deleter is called then.
+   * @{
+   */
+  void
+  SetBufferAsInt8(int8_t * buffer, BufferDeleterType deleter, unsigned int numberOfComponents = 1);
+  void
+  SetBufferAsUInt8(uint8_t * buffer, BufferDeleterType deleter, unsigned int numberOfComponents = 1);
+  void
+  SetBufferAsInt16(int16_t * buffer, BufferDeleterType deleter, unsigned int numberOfComponents = 1);
+  void
+  SetBufferAsUInt16(uint16_t * buffer, BufferDeleterType deleter, unsigned int numberOfComponents = 1);
+  void
+  SetBufferAsInt32(int32_t * buffer, BufferDeleterType deleter, unsigned int numberOfComponents = 1);
+  void
+  SetBufferAsUInt32(uint32_t * buffer, BufferDeleterType deleter, unsigned int numberOfComponents = 1);
+  void
+  SetBufferAsInt64(int64_t * buffer, BufferDeleterType deleter, unsigned int numberOfComponents = 1);
+  void
+  SetBufferAsUInt64(uint64_t * buffer, BufferDeleterType deleter, unsigned int numberOfComponents = 1);
+  void
+  SetBufferAsFloat(float * buffer, BufferDeleterType deleter, unsigned int numberOfComponents = 1);
+  void
+  SetBufferAsDouble(double * buffer, BufferDeleterType deleter, unsigned int numberOfComponents = 1);
+  /** @} */
+
   Image
   Execute() override;
 
@@ -131,7 +173,14 @@ private:
   std::vector<unsigned int> m_Size;
   std::vector<double>       m_Direction;
 
+  template <typename TPixelType>
+  void
+  InternalSetBuffer(TPixelType * buffer, unsigned int numberOfComponents);
+
   void * m_Buffer{ nullptr };
+
+  // owns m_Buffer when set with a deleter
+  std::shared_ptr<void> m_BufferOwner;
 };
 
 Image SITKIO_EXPORT
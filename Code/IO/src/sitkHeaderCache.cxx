@@ -0,0 +1,272 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "sitkHeaderCache.h"
+
+#include "itksys/SystemInformation.hxx"
+#include "itksys/SystemTools.hxx"
+#include "itksys/FStream.hxx"
+
+#include <functional>
+#include <istream>
+#include <ostream>
+#include <sstream>
+#include <thread>
+
+namespace itk::simple::ioutils
+{
+
+namespace
+{
+
+const char * const HeaderCacheSignature = "SimpleITK header cache 2";
+
+// Strings are written prefixed with their length, so they may contain any character.
+void
+WriteCacheString(std::ostream & out, const std::string & s)
+{
+  out << s.size() << ':' << s;
+}
+
+bool
+ReadCacheString(std::istream & in, std::string & s)
+{
+  size_t length = 0;
+  if (!(in >> length) || in.get() != ':')
+  {
+    return false;
+  }
+  s.resize(length);
+  return length == 0 || static_cast<bool>(in.read(&s[0], static_cast<std::streamsize>(length)));
+}
+
+bool
+StatImageFile(const std::string & fileName, uint64_t & fileSize, int64_t & modifiedTime)
+{
+  itksys::SystemTools::Stat_t st;
+  if (!itksys::SystemTools::Stat(fileName, &st))
+  {
+    return false;
+  }
+  fileSize = static_cast<uint64_t>(st.st_size);
+
+  // The modification time in nanoseconds, so a file rewritten within
+  // the same second with the same size is detected where the file
+  // system records sub-second times.
+#if defined(_WIN32)
+  modifiedTime = static_cast<int64_t>(st.st_mtime) * 1000000000;
+#elif defined(__APPLE__)
+  modifiedTime = static_cast<int64_t>(st.st_mtimespec.tv_sec) * 1000000000 + st.st_mtimespec.tv_nsec;
+#else
+  modifiedTime = static_cast<int64_t>(st.st_mtim.tv_sec) * 1000000000 + st.st_mtim.tv_nsec;
+#endif
+  return true;
+}
+
+std::string
+EntryKey(const std::string & kind, const std::string & imageFileName)
+{
+  return kind + '|' + itksys::SystemTools::CollapseFullPath(imageFileName);
+}
+
+} // namespace
+
+
+std::shared_ptr<HeaderCache>
+HeaderCache::Open(const std::string & fileName)
+{
+  static std::mutex                                         openCachesMutex;
+  static std::map<std::string, std::weak_ptr<HeaderCache>> openCaches;
+
+  const std::string fullPath = itksys::SystemTools::CollapseFullPath(fileName);
+
+  std::lock_guard<std::mutex>  lock(openCachesMutex);
+  std::shared_ptr<HeaderCache> cache = openCaches[fullPath].lock();
+  if (!cache)
+  {
+    cache.reset(new HeaderCache(fullPath));
+    cache->Load();
+    openCaches[fullPath] = cache;
+  }
+  return cache;
+}
+
+
+HeaderCache::HeaderCache(std::string fileName)
+  : m_FileName(std::move(fileName))
+{}
+
+
+HeaderCache::~HeaderCache()
+{
+  try
+  {
+    this->Flush();
+  }
+  catch (...)
+  {
+    // The cache is only an optimization, failing to write it is not an error.
+  }
+}
+
+
+bool
+HeaderCache::Find(const std::string & kind, const std::string & imageFileName, ValuesType & values) const
+{
+  uint64_t fileSize = 0;
+  int64_t  modifiedTime = 0;
+  if (!StatImageFile(imageFileName, fileSize, modifiedTime))
+  {
+    return false;
+  }
+
+  const std::string           key = EntryKey(kind, imageFileName);
+  std::lock_guard<std::mutex> lock(m_Mutex);
+
+  auto iter = m_Entries.find(key);
+  if (iter == m_Entries.end() || iter->second.FileSize != fileSize || iter->second.ModifiedTime != modifiedTime)
+  {
+    return false;
+  }
+  values = iter->second.Values;
+  return true;
+}
+
+
+void
+HeaderCache::Insert(const std::string & kind, const std::string & imageFileName, const ValuesType & values)
+{
+  Entry entry;
+  if (!StatImageFile(imageFileName, entry.FileSize, entry.ModifiedTime))
+  {
+    return;
+  }
+  entry.Values = values;
+
+  const std::string           key = EntryKey(kind, imageFileName);
+  std::lock_guard<std::mutex> lock(m_Mutex);
+
+  m_Entries[key] = std::move(entry);
+  m_Modified = true;
+}
+
+
+void
+HeaderCache::Load()
+{
+  itksys::ifstream in(m_FileName.c_str(), std::ios::in | std::ios::binary);
+  if (!in)
+  {
+    return;
+  }
+
+  std::string signature;
+  if (!std::getline(in, signature) || signature != HeaderCacheSignature)
+  {
+    return;
+  }
+
+  std::map<std::string, Entry> entries;
+  std::string                  key;
+  while (ReadCacheString(in, key))
+  {
+    Entry  entry;
+    size_t numberOfValues = 0;
+    if (!(in >> entry.FileSize >> entry.ModifiedTime >> numberOfValues))
+    {
+      return;
+    }
+
+    for (size_t i = 0; i < numberOfValues; ++i)
+    {
+      std::string name;
+      std::string value;
+      if (!ReadCacheString(in, name) || !ReadCacheString(in, value))
+      {
+        return;
+      }
+      entry.Values.emplace(std::move(name), std::move(value));
+    }
+    entries[key] = std::move(entry);
+  }
+
+  // Entries of this process are newer than those in the file.
+  m_Entries.merge(entries);
+}
+
+
+void
+HeaderCache::Flush()
+{
+  std::lock_guard<std::mutex> lock(m_Mutex);
+
+  if (!m_Modified)
+  {
+    return;
+  }
+
+  // Keep the entries written by other processes since the cache was loaded.
+  this->Load();
+
+  // The temporary file is unique to the process and thread, so
+  // concurrent writers of the same cache do not write the same file.
+  itksys::SystemInformation info;
+  std::ostringstream        tmpName;
+  tmpName << m_FileName << ".tmp" << info.GetProcessId() << '_'
+          << std::hash<std::thread::id>{}(std::this_thread::get_id());
+  const std::string tempFileName = tmpName.str();
+  {
+    itksys::ofstream out(tempFileName.c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+    if (!out)
+    {
+      return;
+    }
+
+    out << HeaderCacheSignature << '\n';
+    for (const auto & keyEntry : m_Entries)
+    {
+      const Entry & entry = keyEntry.second;
+      WriteCacheString(out, keyEntry.first);
+      out << ' ' << entry.FileSize << ' ' << entry.ModifiedTime << ' ' << entry.Values.size() << '\n';
+      for (const auto & nameValue : entry.Values)
+      {
+        WriteCacheString(out, nameValue.first);
+        WriteCacheString(out, nameValue.second);
+        out << '\n';
+      }
+    }
+
+    if (!out)
+    {
+      out.close();
+      itksys::SystemTools::RemoveFile(tempFileName);
+      return;
+    }
+  }
+
+  if (itksys::SystemTools::RenameFile(tempFileName, m_FileName))
+  {
+    m_Modified = false;
+  }
+  else
+  {
+    itksys::SystemTools::RemoveFile(tempFileName);
+  }
+}
+
+} // namespace itk::simple::ioutils
@@ -0,0 +1,100 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#ifndef sitkHeaderCache_h
+#define sitkHeaderCache_h
+
+#include "sitkIO.h"
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace itk::simple::ioutils
+{
+
+/* Internal persistent cache of the information parsed from the
+ * headers of image files.
+ *
+ * The entries are stored in a local file, and are keyed by the kind
+ * of information and the full path of the image file. An entry is
+ * only valid while the size and the modification time of the image
+ * file match those recorded when the entry was inserted, so looking
+ * up an unchanged file costs a stat of the file instead of parsing
+ * its header.
+ *
+ * The caches are shared by file name within the process, and the
+ * methods may be called concurrently. The cache file is written when
+ * the last reference to a modified cache is released. Reading or
+ * writing the cache file never fails, as an unreadable cache is
+ * treated as empty.
+ */
+class SITKIO_HIDDEN HeaderCache
+{
+public:
+  using ValuesType = std::map<std::string, std::string>;
+
+  /* Get the cache stored in fileName, loading it if it is not
+   * already used in this process. */
+  static std::shared_ptr<HeaderCache>
+  Open(const std::string & fileName);
+
+  ~HeaderCache();
+
+  HeaderCache(const HeaderCache &) = delete;
+  HeaderCache &
+  operator=(const HeaderCache &) = delete;
+
+  /* Get the values for an image file if the file has not changed
+   * since they were inserted. */
+  bool
+  Find(const std::string & kind, const std::string & imageFileName, ValuesType & values) const;
+
+  /* Set the values for the current state of an image file. */
+  void
+  Insert(const std::string & kind, const std::string & imageFileName, const ValuesType & values);
+
+  /* Write the cache file if entries have been inserted since it was
+   * loaded or last written. */
+  void
+  Flush();
+
+private:
+  explicit HeaderCache(std::string fileName);
+
+  struct Entry
+  {
+    uint64_t   FileSize{ 0 };
+    int64_t    ModifiedTime{ 0 }; // nanoseconds since the epoch
+    ValuesType Values;
+  };
+
+  void
+  Load();
+
+  const std::string            m_FileName;
+  mutable std::mutex           m_Mutex;
+  std::map<std::string, Entry> m_Entries;
+  bool                         m_Modified{ false };
+};
+
+} // namespace itk::simple::ioutils
+
+#endif
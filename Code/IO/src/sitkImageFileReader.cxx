@@ -23,10 +23,17 @@
 
 #include <itkImageFileReader.h>
 #include <itkExtractImageFilter.h>
+#include <itkDeleterImportImageContainer.h>
 
+#include <iomanip>
+#include <limits>
 #include <memory>
+#include <sstream>
 
 #include "sitkMetaDataDictionaryCustomCast.hxx"
+#include "sitkImageIOUtilities.h"
+#include "sitkHeaderCache.h"
+#include "sitkExecutionTrace.h"
 
 namespace itk::simple
 {
@@ -35,36 +42,101 @@ constexpr unsigned int SITK_IO_INPUT_MAX_DIMENSION = 5 > SITK_MAX_DIMENSION ? 5
 namespace
 {
 
-// Simple ITK must use a zero based index
+// Create an image whose buffer is a memory mapping of the file being
+// read. The reader's output information is updated, but the pixel
+// data is not read. If the file can not be mapped a nullptr is
+// returned.
 template <class TImageType>
-static void
-FixNonZeroIndex(TImageType * img)
+typename TImageType::Pointer
+MemoryMapImage(itk::ImageFileReader<TImageType> * reader)
 {
-  assert(img != nullptr);
+  using ImageType = TImageType;
+  using InternalPixelType = typename ImageType::InternalPixelType;
+  using ComponentType = typename itk::NumericTraits<InternalPixelType>::ValueType;
+
+  reader->UpdateOutputInformation();
 
-  typename TImageType::RegionType r = img->GetLargestPossibleRegion();
-  typename TImageType::IndexType  idx = r.GetIndex();
+  const itk::ImageIOBase * imageio = reader->GetImageIO();
 
-  for (unsigned int i = 0; i < TImageType::ImageDimension; ++i)
+  // The pixel in the file must not require conversion
+  const size_t pixelSize = sizeof(InternalPixelType) * (IsVector<ImageType>::Value ? imageio->GetNumberOfComponents() : 1);
+  if (imageio->GetComponentType() != itk::ImageIOBase::MapPixelType<ComponentType>::CType ||
+      imageio->GetComponentSize() * imageio->GetNumberOfComponents() != pixelSize)
   {
+    return nullptr;
+  }
 
-    if (idx[i] != 0)
-    {
-      // if any of the indicies are non-zero, then just fix it
-      typename TImageType::PointType o;
-      img->TransformIndexToPhysicalPoint(idx, o);
-      img->SetOrigin(o);
+  std::string dataFileName;
+  uint64_t    dataOffset = 0;
+  if (!ioutils::GetUncompressedDataLocation(imageio, dataFileName, dataOffset) ||
+      dataOffset % sizeof(ComponentType) != 0)
+  {
+    return nullptr;
+  }
 
-      idx.Fill(0);
-      r.SetIndex(idx);
+  std::shared_ptr<void> mapping =
+    ioutils::MemoryMapFile(dataFileName, dataOffset, static_cast<uint64_t>(imageio->GetImageSizeInBytes()));
+  if (!mapping)
+  {
+    return nullptr;
+  }
 
-      // Need to set the buffered region to match largest
-      img->SetRegions(r);
+  typename ImageType::Pointer image = reader->GetOutput();
+  image->DisconnectPipeline();
+  image->SetBufferedRegion(image->GetLargestPossibleRegion());
+  image->SetMetaDataDictionary(imageio->GetMetaDataDictionary());
 
-      return;
-    }
+  size_t numberOfElements = image->GetLargestPossibleRegion().GetNumberOfPixels();
+  if constexpr (IsVector<ImageType>::Value)
+  {
+    image->SetNumberOfComponentsPerPixel(imageio->GetNumberOfComponents());
+    numberOfElements *= imageio->GetNumberOfComponents();
+  }
+
+  using ContainerType = itk::DeleterImportImageContainer<itk::SizeValueType, InternalPixelType>;
+  auto container = ContainerType::New();
+  container->SetImportPointer(
+    static_cast<InternalPixelType *>(mapping.get()), numberOfElements, [mapping](void *) mutable { mapping.reset(); });
+  image->SetPixelContainer(container);
+
+  return image;
+}
+
+
+// Prefix of the names of the meta-data entries in the header cache values.
+const std::string HeaderCacheMetaDataPrefix = "MetaData:";
+
+template <typename T>
+std::string
+HeaderCacheVectorToString(const std::vector<T> & v)
+{
+  std::ostringstream out;
+  out << std::setprecision(std::numeric_limits<double>::max_digits10);
+  for (size_t i = 0; i < v.size(); ++i)
+  {
+    out << (i ? " " : "") << v[i];
+  }
+  return out.str();
+}
+
+template <typename T>
+std::vector<T>
+ParseHeaderCacheVector(const std::string & s)
+{
+  std::istringstream in(s);
+  std::vector<T>     v;
+  T                  value;
+  while (in >> value)
+  {
+    v.push_back(value);
+  }
+  if (!in.eof())
+  {
+    sitkExceptionMacro("Unable to parse \"" << s << "\" from the header cache.");
   }
+  return v;
 }
+
 } // namespace
 
 Image
@@ -105,6 +177,9 @@ ImageFileReader::ToString() const
   this->ToStringHelper(out, this->m_FileName) << "\"" << std::endl;
   out << "  ExtractSize: " << this->m_ExtractSize << std::endl;
   out << "  ExtractIndex: " << this->m_ExtractIndex << std::endl;
+  out << "  UseMemoryMapping: " << this->m_UseMemoryMapping << std::endl;
+  out << "  HeaderCacheFileName: \"";
+  this->ToStringHelper(out, this->m_HeaderCacheFileName) << "\"" << std::endl;
 
   out << "  Image Information:" << std::endl << "    PixelType: ";
   this->ToStringHelper(out, this->m_PixelType) << std::endl;
@@ -154,15 +229,7 @@ ImageFileReader ::UpdateImageInformationFromImageIO(const itk::ImageIOBase * iob
     }
   }
 
-  // release functions bound to old meta data dictionary
-  if (m_MetaDataDictionary.get())
-  {
-    this->m_pfGetMetaDataKeys = nullptr;
-    this->m_pfHasMetaDataKey = nullptr;
-    this->m_pfGetMetaData = nullptr;
-  }
-
-  this->m_MetaDataDictionary = std::make_unique<MetaDataDictionary>(iobase->GetMetaDataDictionary());
+  this->UpdateMetaDataDictionary(iobase->GetMetaDataDictionary());
 
   m_PixelType = static_cast<PixelIDValueEnum>(pixelType);
 
@@ -174,6 +241,103 @@ ImageFileReader ::UpdateImageInformationFromImageIO(const itk::ImageIOBase * iob
   swap(origin, m_Origin);
   swap(spacing, m_Spacing);
   swap(size, m_Size);
+}
+
+bool
+ImageFileReader::UpdateImageInformationFromHeaderCache(const std::map<std::string, std::string> & values)
+{
+  auto getValue = [&values](const std::string & name) -> const std::string & {
+    auto iter = values.find(name);
+    if (iter == values.end())
+    {
+      sitkExceptionMacro("Missing \"" << name << "\" in the header cache entry.");
+    }
+    return iter->second;
+  };
+
+  try
+  {
+    // The pixel id values depend on the pixel types instantiated in this build.
+    const PixelIDValueType pixelType = std::stoi(getValue("PixelID"));
+    if (GetPixelIDValueAsString(pixelType) != getValue("PixelIDDescription"))
+    {
+      return false;
+    }
+
+    const auto dimension = static_cast<unsigned int>(std::stoul(getValue("Dimension")));
+    const auto numberOfComponents = static_cast<unsigned int>(std::stoul(getValue("NumberOfComponents")));
+
+    std::vector<double>   direction = ParseHeaderCacheVector<double>(getValue("Direction"));
+    std::vector<double>   origin = ParseHeaderCacheVector<double>(getValue("Origin"));
+    std::vector<double>   spacing = ParseHeaderCacheVector<double>(getValue("Spacing"));
+    std::vector<uint64_t> size = ParseHeaderCacheVector<uint64_t>(getValue("Size"));
+    if (direction.size() != dimension * dimension || origin.size() != dimension || spacing.size() != dimension ||
+        size.size() != dimension)
+    {
+      return false;
+    }
+
+    MetaDataDictionary metaDataDictionary;
+    for (const auto & nameValue : values)
+    {
+      if (nameValue.first.compare(0, HeaderCacheMetaDataPrefix.size(), HeaderCacheMetaDataPrefix) == 0)
+      {
+        EncapsulateMetaData<std::string>(
+          metaDataDictionary, nameValue.first.substr(HeaderCacheMetaDataPrefix.size()), nameValue.second);
+      }
+    }
+    this->UpdateMetaDataDictionary(metaDataDictionary);
+
+    m_PixelType = static_cast<PixelIDValueEnum>(pixelType);
+    m_Dimension = dimension;
+    m_NumberOfComponents = numberOfComponents;
+
+    using std::swap;
+    swap(direction, m_Direction);
+    swap(origin, m_Origin);
+    swap(spacing, m_Spacing);
+    swap(size, m_Size);
+  }
+  catch (std::exception &)
+  {
+    // An incomplete or invalid entry is ignored, and the header is read again.
+    return false;
+  }
+  return true;
+}
+
+std::map<std::string, std::string>
+ImageFileReader::GetImageInformationForHeaderCache() const
+{
+  std::map<std::string, std::string> values;
+  values["PixelID"] = std::to_string(static_cast<PixelIDValueType>(m_PixelType));
+  values["PixelIDDescription"] = GetPixelIDValueAsString(m_PixelType);
+  values["Dimension"] = std::to_string(m_Dimension);
+  values["NumberOfComponents"] = std::to_string(m_NumberOfComponents);
+  values["Direction"] = HeaderCacheVectorToString(m_Direction);
+  values["Origin"] = HeaderCacheVectorToString(m_Origin);
+  values["Spacing"] = HeaderCacheVectorToString(m_Spacing);
+  values["Size"] = HeaderCacheVectorToString(m_Size);
+
+  for (const auto & key : this->GetMetaDataKeys())
+  {
+    values[HeaderCacheMetaDataPrefix + key] = this->GetMetaData(key);
+  }
+  return values;
+}
+
+void
+ImageFileReader::UpdateMetaDataDictionary(const MetaDataDictionary & metaDataDictionary)
+{
+  // release functions bound to old meta data dictionary
+  if (m_MetaDataDictionary.get())
+  {
+    this->m_pfGetMetaDataKeys = nullptr;
+    this->m_pfHasMetaDataKey = nullptr;
+    this->m_pfGetMetaData = nullptr;
+  }
+
+  this->m_MetaDataDictionary = std::make_unique<MetaDataDictionary>(metaDataDictionary);
 
   this->m_pfGetMetaDataKeys = [capture0 = this->m_MetaDataDictionary.get()] { return capture0->GetKeys(); };
   this->m_pfHasMetaDataKey = [capture0 = this->m_MetaDataDictionary.get()](auto && PH1) {
@@ -235,9 +399,34 @@ ImageFileReader ::GetSize() const
 void
 ImageFileReader ::ReadImageInformation()
 {
+  // The information read depends on the ImageIO forced and on loading the private tags.
+  const std::string headerCacheKind = "ImageFileReader ImageIO:" + this->GetImageIO() +
+                                      " LoadPrivateTags:" + (this->GetLoadPrivateTags() ? "1" : "0");
+
+  if (!this->m_HeaderCacheFileName.empty())
+  {
+    if (!this->m_HeaderCache)
+    {
+      this->m_HeaderCache = ioutils::HeaderCache::Open(this->m_HeaderCacheFileName);
+    }
+
+    std::map<std::string, std::string> values;
+    if (this->m_HeaderCache->Find(headerCacheKind, this->m_FileName, values) &&
+        this->UpdateImageInformationFromHeaderCache(values))
+    {
+      sitkDebugMacro("Image information of \"" << this->m_FileName << "\" read from the header cache.");
+      return;
+    }
+  }
+
   itk::ImageIOBase::Pointer imageio = this->GetImageIOBase(this->m_FileName);
   this->UpdateImageInformationFromImageIO(imageio);
   sitkDebugMacro("ImageIO: " << imageio);
+
+  if (this->m_HeaderCache)
+  {
+    this->m_HeaderCache->Insert(headerCacheKind, this->m_FileName, this->GetImageInformationForHeaderCache());
+  }
 }
 
 
@@ -284,6 +473,34 @@ ImageFileReader::GetExtractIndex() const
   return this->m_ExtractIndex;
 }
 
+void
+ImageFileReader::SetUseMemoryMapping(bool useMemoryMapping)
+{
+  this->m_UseMemoryMapping = useMemoryMapping;
+}
+
+bool
+ImageFileReader::GetUseMemoryMapping() const
+{
+  return this->m_UseMemoryMapping;
+}
+
+void
+ImageFileReader::SetHeaderCacheFileName(const PathType & fileName)
+{
+  if (fileName != this->m_HeaderCacheFileName)
+  {
+    this->m_HeaderCache = nullptr;
+  }
+  this->m_HeaderCacheFileName = fileName;
+}
+
+const PathType &
+ImageFileReader::GetHeaderCacheFileName() const
+{
+  return this->m_HeaderCacheFileName;
+}
+
 Image
 ImageFileReader::Execute()
 {
@@ -291,8 +508,12 @@ ImageFileReader::Execute()
   PixelIDValueType type = this->GetOutputPixelType();
 
 
-  itk::ImageIOBase::Pointer imageio = this->GetImageIOBase(this->m_FileName);
-  this->UpdateImageInformationFromImageIO(imageio);
+  itk::ImageIOBase::Pointer imageio;
+  {
+    ExecutionTraceScope traceScope("ReadImageInformation", "IO");
+    imageio = this->GetImageIOBase(this->m_FileName);
+    this->UpdateImageInformationFromImageIO(imageio);
+  }
 
   sitkDebugMacro("ImageIO: " << imageio->GetNameOfClass());
 
@@ -368,9 +589,33 @@ ImageFileReader::ExecuteInternal(itk::ImageIOBase * imageio)
 
     if (m_ExtractSize.empty())
     {
+      if (this->m_UseMemoryMapping)
+      {
+        ExecutionTraceScope         traceScope("MemoryMapImage", "IO");
+        typename ImageType::Pointer image = MemoryMapImage<ImageType>(reader.GetPointer());
+        if (image)
+        {
+          // The pixels are loaded on demand, but the commands and
+          // the measurements of the reader are the same as when the
+          // image is read.
+          this->PreUpdate(reader.GetPointer());
+          reader->InvokeEvent(itk::StartEvent());
+          FixNonZeroIndex(image.GetPointer());
+          reader->InvokeEvent(itk::EndEvent());
+          return Image(image);
+        }
+        sitkDebugMacro("Unable to memory map \"" << this->m_FileName << "\", reading the image instead.");
+      }
+
+      if (this->GetDeferredExecution())
+      {
+        // The file is read when the image is accessed, or in
+        // divisions by a streamed ImageFileWriter.
+        return this->CastITKToDeferredImage(reader.GetPointer(), reader->GetOutput());
+      }
 
       this->PreUpdate(reader.GetPointer());
-      reader->Update();
+      this->UpdateWithTimeout(reader.GetPointer());
       return Image(reader->GetOutput());
     }
 
@@ -446,7 +691,7 @@ ImageFileReader::ExecuteExtract(TInternalImageType * itkImage)
   assert(itkImage->GetSource() != nullptr);
   this->PreUpdate(itkImage->GetSource().GetPointer());
 
-  extractor->Update();
+  this->UpdateWithTimeout(extractor.GetPointer());
 
   ImageType * itkOutImage = extractor->GetOutput();
   // copy meta-data dictionary
@@ -223,7 +223,11 @@ template <class InputImageType>
 void
 ImageFileWriter::ExecuteInternal(const Image & inImage)
 {
-  typename InputImageType::ConstPointer image = dynamic_cast<const InputImageType *>(inImage.GetITKBase());
+  // When written in divisions, a deferred image is updated one
+  // division at a time by the writer.
+  typename InputImageType::ConstPointer image = (this->GetNumberOfStreamDivisions() > 1)
+                                                  ? this->CastImageToITKDeferred<InputImageType>(inImage)
+                                                  : dynamic_cast<const InputImageType *>(inImage.GetITKBase());
 
   using Writer = itk::ImageFileWriter<InputImageType>;
   typename Writer::Pointer writer = Writer::New();
@@ -231,6 +235,7 @@ ImageFileWriter::ExecuteInternal(const Image & inImage)
   writer->SetCompressionLevel(this->m_CompressionLevel);
   writer->SetFileName(this->m_FileName.c_str());
   writer->SetInput(image);
+  writer->SetNumberOfStreamDivisions(this->GetNumberOfStreamDivisions());
 
   itk::ImageIOBase::Pointer imageio = this->GetImageIOBase(this->m_FileName);
 
@@ -245,7 +250,7 @@ ImageFileWriter::ExecuteInternal(const Image & inImage)
 
   this->PreUpdate(writer.GetPointer());
 
-  writer->Update();
+  this->UpdateWithTimeout(writer.GetPointer());
 }
 
 } // namespace itk::simple
@@ -19,8 +19,25 @@
 #include "sitkMacro.h"
 #include "sitkExceptionObject.h"
 #include "itkImageIOBase.h"
+#include "itkMetaImageIO.h"
+#include "itkByteSwapper.h"
+#include "itksys/SystemTools.hxx"
+#include "itksys/FStream.hxx"
 #include <sstream>
 #include <list>
+#include <cstring>
+
+#if defined(_WIN32)
+#  include "itksys/Encoding.hxx"
+#  ifndef NOMINMAX
+#    define NOMINMAX
+#  endif
+#  include <windows.h>
+#else
+#  include <fcntl.h>
+#  include <sys/mman.h>
+#  include <unistd.h>
+#endif
 
 namespace itk::simple::ioutils
 {
@@ -96,4 +113,231 @@ CreateImageIOByName(const std::string & ioname)
   return iobase;
 }
 
+namespace
+{
+
+// Value of the MetaImage HeaderSize, indicating the data is at the end of the file
+constexpr int64_t DataAtEndOfFile = -1;
+
+bool
+IsNativeByteOrder(bool bigEndian)
+{
+  return bigEndian == itk::ByteSwapper<uint16_t>::SystemIsBigEndian();
+}
+
+bool
+GetMetaImageDataLocation(itk::MetaImageIO * metaIO, std::string & dataFileName, int64_t & headerSize)
+{
+  MetaImage * metaImage = metaIO->GetMetaImagePointer();
+
+  if (metaImage->CompressedData() || !metaImage->BinaryData())
+  {
+    return false;
+  }
+  if (metaIO->GetComponentSize() > 1 && !IsNativeByteOrder(metaImage->BinaryDataByteOrderMSB()))
+  {
+    return false;
+  }
+
+  const std::string elementDataFileName = metaImage->ElementDataFileName();
+  if (elementDataFileName == "LOCAL")
+  {
+    // the data follows the header in the same file
+    dataFileName = metaIO->GetFileName();
+    headerSize = DataAtEndOfFile;
+    return true;
+  }
+  if (elementDataFileName.empty() || elementDataFileName == "LIST" ||
+      elementDataFileName.find('%') != std::string::npos)
+  {
+    // the data is split over multiple files
+    return false;
+  }
+
+  if (itksys::SystemTools::FileIsFullPath(elementDataFileName))
+  {
+    dataFileName = elementDataFileName;
+  }
+  else
+  {
+    dataFileName = itksys::SystemTools::CollapseFullPath(
+      elementDataFileName, itksys::SystemTools::GetFilenamePath(metaIO->GetFileName()));
+  }
+  headerSize = metaImage->HeaderSize();
+  return headerSize >= 0 || headerSize == DataAtEndOfFile;
+}
+
+
+bool
+GetNrrdDataLocation(const itk::ImageIOBase * iobase, std::string & dataFileName, int64_t & headerSize)
+{
+  // The NrrdImageIO may permute the data of multi-component pixels
+  // when reading, so only scalar pixels are supported.
+  if (iobase->GetNumberOfComponents() != 1)
+  {
+    return false;
+  }
+
+  itksys::ifstream in(iobase->GetFileName(), std::ios::in | std::ios::binary);
+  std::string      line;
+  if (!in || !std::getline(in, line) || line.compare(0, 4, "NRRD") != 0)
+  {
+    return false;
+  }
+
+  std::string encoding;
+  std::string endian;
+  while (std::getline(in, line))
+  {
+    if (!line.empty() && line.back() == '\r')
+    {
+      line.pop_back();
+    }
+    if (line.empty())
+    {
+      // blank line marks the end of the header and the start of attached data
+      dataFileName = iobase->GetFileName();
+      headerSize = static_cast<int64_t>(in.tellg());
+      return encoding == "raw" && (iobase->GetComponentSize() == 1 || IsNativeByteOrder(endian == "big"));
+    }
+    if (line[0] == '#' || line.find(":=") != std::string::npos)
+    {
+      // comments and key/value pairs
+      continue;
+    }
+
+    const std::string::size_type colon = line.find(": ");
+    if (colon == std::string::npos)
+    {
+      continue;
+    }
+    const std::string field = line.substr(0, colon);
+    const std::string value = itksys::SystemTools::TrimWhitespace(line.substr(colon + 2));
+    if (field == "encoding")
+    {
+      encoding = value;
+    }
+    else if (field == "endian")
+    {
+      endian = value;
+    }
+    else if (field == "data file" || field == "datafile" || field == "line skip" || field == "lineskip" ||
+             field == "byte skip" || field == "byteskip")
+    {
+      // detached or offset data is not supported
+      return false;
+    }
+  }
+  return false;
+}
+
+} // namespace
+
+
+bool
+GetUncompressedDataLocation(const ImageIOBase * iobase, std::string & dataFileName, uint64_t & dataOffset)
+{
+  int64_t headerSize = 0;
+  if (auto metaIO = dynamic_cast<const itk::MetaImageIO *>(iobase))
+  {
+    if (!GetMetaImageDataLocation(const_cast<itk::MetaImageIO *>(metaIO), dataFileName, headerSize))
+    {
+      return false;
+    }
+  }
+  else if (std::strcmp(iobase->GetNameOfClass(), "NrrdImageIO") == 0)
+  {
+    if (!GetNrrdDataLocation(iobase, dataFileName, headerSize))
+    {
+      return false;
+    }
+  }
+  else
+  {
+    return false;
+  }
+
+  const uint64_t dataSize = iobase->GetImageSizeInBytes();
+  const uint64_t fileLength = itksys::SystemTools::FileLength(dataFileName);
+
+  if (headerSize == DataAtEndOfFile)
+  {
+    if (fileLength < dataSize)
+    {
+      return false;
+    }
+    dataOffset = fileLength - dataSize;
+    return true;
+  }
+
+  dataOffset = static_cast<uint64_t>(headerSize);
+  return dataOffset + dataSize <= fileLength;
+}
+
+
+std::shared_ptr<void>
+MemoryMapFile(const std::string & fileName, uint64_t offset, uint64_t length)
+{
+  if (length == 0)
+  {
+    return nullptr;
+  }
+
+#if defined(_WIN32)
+  SYSTEM_INFO systemInfo;
+  GetSystemInfo(&systemInfo);
+  const uint64_t alignedOffset = offset - offset % systemInfo.dwAllocationGranularity;
+  const uint64_t mappedLength = length + (offset - alignedOffset);
+
+  HANDLE file = CreateFileW(itksys::Encoding::ToWindowsExtendedPath(fileName).c_str(),
+                            GENERIC_READ,
+                            FILE_SHARE_READ,
+                            nullptr,
+                            OPEN_EXISTING,
+                            FILE_ATTRIBUTE_NORMAL,
+                            nullptr);
+  if (file == INVALID_HANDLE_VALUE)
+  {
+    return nullptr;
+  }
+  HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+  CloseHandle(file);
+  if (mapping == nullptr)
+  {
+    return nullptr;
+  }
+  void * address = MapViewOfFile(mapping,
+                                 FILE_MAP_COPY,
+                                 static_cast<DWORD>(alignedOffset >> 32),
+                                 static_cast<DWORD>(alignedOffset & 0xFFFFFFFF),
+                                 static_cast<SIZE_T>(mappedLength));
+  CloseHandle(mapping);
+  if (address == nullptr)
+  {
+    return nullptr;
+  }
+  return std::shared_ptr<void>(static_cast<char *>(address) + (offset - alignedOffset),
+                               [address](void *) { UnmapViewOfFile(address); });
+#else
+  const uint64_t pageSize = static_cast<uint64_t>(sysconf(_SC_PAGESIZE));
+  const uint64_t alignedOffset = offset - offset % pageSize;
+  const size_t   mappedLength = static_cast<size_t>(length + (offset - alignedOffset));
+
+  const int fd = open(fileName.c_str(), O_RDONLY);
+  if (fd == -1)
+  {
+    return nullptr;
+  }
+  void * address =
+    mmap(nullptr, mappedLength, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, static_cast<off_t>(alignedOffset));
+  close(fd);
+  if (address == MAP_FAILED)
+  {
+    return nullptr;
+  }
+  return std::shared_ptr<void>(static_cast<char *>(address) + (offset - alignedOffset),
+                               [address, mappedLength](void *) { munmap(address, mappedLength); });
+#endif
+}
+
 } // namespace itk::simple::ioutils
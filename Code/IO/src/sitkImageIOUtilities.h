@@ -22,6 +22,8 @@
 #include <string>
 #include <vector>
 #include <ostream>
+#include <memory>
+#include <cstdint>
 
 namespace itk
 {
@@ -53,6 +55,32 @@ SITKIO_HIDDEN std::vector<std::string>
 SITKIO_HIDDEN itk::SmartPointer<ImageIOBase>
               CreateImageIOByName(const std::string & ioname);
 
+
+/* Internal method which determines if the bulk pixel data of the
+ * file, for which the ImageIO has read the image information, is
+ * stored contiguously, uncompressed and in the native byte order.
+ *
+ * Currently MetaImage files and NRRD files with a scalar pixel type
+ * and raw encoding are supported. If true is returned, then the name
+ * of the file containing the data and the offset to the first byte
+ * of the data in the file are set.
+ */
+SITKIO_HIDDEN bool
+GetUncompressedDataLocation(const ImageIOBase * iobase, std::string & dataFileName, uint64_t & dataOffset);
+
+
+/* Internal method which maps length bytes starting at offset of a
+ * file into memory.
+ *
+ * The mapping is private, so modification of the memory are copy on
+ * write and are not written to the file. The returned pointer
+ * unmaps the file when the last reference is released. On failure
+ * a nullptr is returned.
+ */
+SITKIO_HIDDEN std::shared_ptr<void>
+              MemoryMapFile(const std::string & fileName, uint64_t offset, uint64_t length);
+
+
 } // namespace simple::ioutils
 } // namespace itk
 
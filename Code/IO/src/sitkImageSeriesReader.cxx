@@ -23,15 +23,221 @@
 
 #include <itkImageIOBase.h>
 #include <itkImageSeriesReader.h>
-
+#include <itkImageFileReader.h>
+#include <itkExtractImageFilter.h>
+#include <itkGDCMImageIO.h>
+#include <itkMultiThreaderBase.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <iterator>
 #include <memory>
+#include <set>
+#include <sstream>
 
 #include "itkGDCMSeriesFileNames.h"
+#include "gdcmDirectory.h"
+#include "gdcmReader.h"
+#include "gdcmStringFilter.h"
 #include "sitkMetaDataDictionaryCustomCast.hxx"
+#include "sitkHeaderCache.h"
 
 namespace itk::simple
 {
 
+namespace
+{
+
+// The header values of one file parsed by ScanDICOMDirectory
+struct DICOMFileHeader
+{
+  bool                               IsDICOM{ false };
+  std::string                        SeriesUID;
+  std::vector<double>                ImagePositionPatient;
+  std::vector<double>                ImageOrientationPatient;
+  std::string                        InstanceNumber;
+  std::map<std::string, std::string> MetaData;
+};
+
+// Remove the padding of a DICOM string value
+std::string
+TrimDICOMValue(std::string value)
+{
+  const auto last = value.find_last_not_of(std::string(" \0", 2));
+  value.erase(last == std::string::npos ? 0 : last + 1);
+  return value;
+}
+
+// Parse a multi-valued DICOM decimal string such as "1.0\0.0\0.0"
+std::vector<double>
+ParseDICOMDecimals(std::string value)
+{
+  std::replace(value.begin(), value.end(), '\\', ' ');
+  std::istringstream  iss(value);
+  std::vector<double> result;
+  double              v;
+  while (iss >> v)
+  {
+    result.push_back(v);
+  }
+  return result;
+}
+
+// Parse a tag in the "gggg|eeee" format of the meta-data dictionary
+gdcm::Tag
+ParseDICOMTag(const std::string & key)
+{
+  unsigned int group = 0;
+  unsigned int element = 0;
+  char         extra = 0;
+  if (key.size() != 9 || std::sscanf(key.c_str(), "%4x|%4x%c", &group, &element, &extra) != 2)
+  {
+    sitkExceptionMacro("Invalid DICOM tag \"" << key << "\", expected the \"gggg|eeee\" format.");
+  }
+  return gdcm::Tag(static_cast<uint16_t>(group), static_cast<uint16_t>(element));
+}
+
+// Prefix of the names of the requested tags in the header values of a file.
+const std::string DICOMHeaderMetaDataPrefix = "MetaData:";
+
+// Parse the header of a file, up to the pixel data, into the values used by
+// ScanDICOMDirectory and stored in the header cache.
+std::map<std::string, std::string>
+ReadDICOMHeaderValues(const PathType &                 fileName,
+                      const std::vector<gdcm::Tag> &   requestedTags,
+                      const std::vector<std::string> & tags)
+{
+  std::map<std::string, std::string> values;
+
+  std::string tagList;
+  for (const auto & key : tags)
+  {
+    tagList += key + " ";
+  }
+  values["Tags"] = tagList;
+  values["IsDICOM"] = "0";
+
+  const gdcm::Tag           pixelDataTag(0x7fe0, 0x0010);
+  const std::set<gdcm::Tag> skipTags{ pixelDataTag };
+
+  gdcm::Reader reader;
+  reader.SetFileName(fileName.c_str());
+  if (!reader.ReadUpToTag(pixelDataTag, skipTags))
+  {
+    return values;
+  }
+
+  const gdcm::DataSet & ds = reader.GetFile().GetDataSet();
+  gdcm::StringFilter    sf;
+  sf.SetFile(reader.GetFile());
+
+  values["SeriesInstanceUID"] = TrimDICOMValue(sf.ToString(gdcm::Tag(0x0020, 0x000e)));
+  values["ImagePositionPatient"] = sf.ToString(gdcm::Tag(0x0020, 0x0032));
+  values["ImageOrientationPatient"] = sf.ToString(gdcm::Tag(0x0020, 0x0037));
+  values["InstanceNumber"] = sf.ToString(gdcm::Tag(0x0020, 0x0013));
+  for (size_t t = 0; t < requestedTags.size(); ++t)
+  {
+    if (ds.FindDataElement(requestedTags[t]))
+    {
+      values[DICOMHeaderMetaDataPrefix + tags[t]] = sf.ToString(requestedTags[t]);
+    }
+  }
+  values["IsDICOM"] = values["SeriesInstanceUID"].empty() ? "0" : "1";
+  return values;
+}
+
+// Check that the cached header values of a file contain the requested tags
+bool
+HasDICOMHeaderValues(const std::map<std::string, std::string> & values, const std::vector<std::string> & tags)
+{
+  auto isDICOM = values.find("IsDICOM");
+  auto tagList = values.find("Tags");
+  if (isDICOM == values.end() || tagList == values.end())
+  {
+    return false;
+  }
+  if (isDICOM->second != "1")
+  {
+    return true;
+  }
+
+  std::istringstream    iss(tagList->second);
+  std::set<std::string> cachedTags{ std::istream_iterator<std::string>(iss), std::istream_iterator<std::string>() };
+  return std::all_of(
+    tags.begin(), tags.end(), [&cachedTags](const std::string & key) { return cachedTags.count(key) != 0; });
+}
+
+// Sort the files of a series as gdcm::SerieHelper does: by the distance along the slice
+// normal, then by the instance number, and finally by the file name.
+void
+SortDICOMSeries(std::vector<std::pair<PathType, const DICOMFileHeader *>> & files)
+{
+  const std::vector<double> & iop = files.front().second->ImageOrientationPatient;
+
+  std::vector<double> distances;
+  if (iop.size() == 6)
+  {
+    const double normal[3] = { iop[1] * iop[5] - iop[2] * iop[4],
+                               iop[2] * iop[3] - iop[0] * iop[5],
+                               iop[0] * iop[4] - iop[1] * iop[3] };
+    for (const auto & f : files)
+    {
+      const std::vector<double> & ipp = f.second->ImagePositionPatient;
+      if (ipp.size() != 3)
+      {
+        distances.clear();
+        break;
+      }
+      distances.push_back(normal[0] * ipp[0] + normal[1] * ipp[1] + normal[2] * ipp[2]);
+    }
+  }
+
+  std::vector<size_t> order(files.size());
+  for (size_t i = 0; i < order.size(); ++i)
+  {
+    order[i] = i;
+  }
+
+  if (distances.size() == files.size() && std::set<double>(distances.begin(), distances.end()).size() == files.size())
+  {
+    std::sort(order.begin(), order.end(), [&distances](size_t a, size_t b) { return distances[a] < distances[b]; });
+  }
+  else
+  {
+    std::vector<double> numbers;
+    for (const auto & f : files)
+    {
+      const std::vector<double> n = ParseDICOMDecimals(f.second->InstanceNumber);
+      if (n.empty())
+      {
+        break;
+      }
+      numbers.push_back(n.front());
+    }
+
+    if (numbers.size() == files.size() && std::set<double>(numbers.begin(), numbers.end()).size() > 1)
+    {
+      std::stable_sort(
+        order.begin(), order.end(), [&numbers](size_t a, size_t b) { return numbers[a] < numbers[b]; });
+    }
+    else
+    {
+      std::sort(order.begin(), order.end(), [&files](size_t a, size_t b) { return files[a].first < files[b].first; });
+    }
+  }
+
+  std::vector<std::pair<PathType, const DICOMFileHeader *>> sorted;
+  sorted.reserve(files.size());
+  for (size_t i : order)
+  {
+    sorted.push_back(files[i]);
+  }
+  files.swap(sorted);
+}
+
+} // namespace
+
 const detail::MemberFunctionFactory<ImageSeriesReader::MemberFunctionType> &
 ImageSeriesReader::GetMemberFunctionFactory()
 {
@@ -89,6 +295,90 @@ ImageSeriesReader::GetGDCMSeriesIDs(const PathType & directory, bool useSeriesDe
   return gdcmSeries->GetSeriesUIDs();
 }
 
+std::map<std::string, DICOMSeries>
+ImageSeriesReader::ScanDICOMDirectory(const PathType &                 directory,
+                                      const std::vector<std::string> & tags,
+                                      bool                             recursive,
+                                      const PathType &                 headerCacheFileName)
+{
+  std::vector<gdcm::Tag> requestedTags;
+  for (const auto & key : tags)
+  {
+    requestedTags.push_back(ParseDICOMTag(key));
+  }
+
+  gdcm::Directory gdcmDirectory;
+  gdcmDirectory.Load(directory, recursive);
+  std::vector<PathType> filenames = gdcmDirectory.GetFilenames();
+  std::sort(filenames.begin(), filenames.end());
+
+  std::vector<DICOMFileHeader> headers(filenames.size());
+
+  std::shared_ptr<ioutils::HeaderCache> headerCache;
+  if (!headerCacheFileName.empty())
+  {
+    headerCache = ioutils::HeaderCache::Open(headerCacheFileName);
+  }
+
+  // Each file not found in the header cache is parsed once, up to the pixel data, concurrently.
+  auto mt = itk::MultiThreaderBase::New();
+  mt->SetNumberOfWorkUnits(mt->GetMaximumNumberOfThreads());
+  mt->ParallelizeArray(
+    0,
+    filenames.size(),
+    [&filenames, &headers, &requestedTags, &tags, &headerCache](SizeValueType i) {
+      std::map<std::string, std::string> values;
+      if (!headerCache || !headerCache->Find("ScanDICOMDirectory", filenames[i], values) ||
+          !HasDICOMHeaderValues(values, tags))
+      {
+        values = ReadDICOMHeaderValues(filenames[i], requestedTags, tags);
+        if (headerCache)
+        {
+          headerCache->Insert("ScanDICOMDirectory", filenames[i], values);
+        }
+      }
+
+      DICOMFileHeader & header = headers[i];
+      header.IsDICOM = values["IsDICOM"] == "1";
+      header.SeriesUID = values["SeriesInstanceUID"];
+      header.ImagePositionPatient = ParseDICOMDecimals(values["ImagePositionPatient"]);
+      header.ImageOrientationPatient = ParseDICOMDecimals(values["ImageOrientationPatient"]);
+      header.InstanceNumber = values["InstanceNumber"];
+      for (const auto & key : tags)
+      {
+        auto iter = values.find(DICOMHeaderMetaDataPrefix + key);
+        if (iter != values.end())
+        {
+          header.MetaData[key] = iter->second;
+        }
+      }
+    },
+    nullptr);
+
+  std::map<std::string, std::vector<std::pair<PathType, const DICOMFileHeader *>>> seriesFiles;
+  for (size_t i = 0; i < filenames.size(); ++i)
+  {
+    if (headers[i].IsDICOM)
+    {
+      seriesFiles[headers[i].SeriesUID].emplace_back(filenames[i], &headers[i]);
+    }
+  }
+
+  std::map<std::string, DICOMSeries> result;
+  for (auto & s : seriesFiles)
+  {
+    SortDICOMSeries(s.second);
+
+    DICOMSeries & series = result[s.first];
+    for (const auto & f : s.second)
+    {
+      series.FileNames.push_back(f.first);
+      series.MetaData.push_back(f.second->MetaData);
+    }
+  }
+  return result;
+}
+
 double
 ImageSeriesReader::GetSpacingWarningRelThreshold() const
 {
@@ -149,6 +439,42 @@ ImageSeriesReader::ReverseOrderOff()
   this->SetReverseOrder(false);
 }
 
+void
+ImageSeriesReader::SetExtractSize(const std::vector<unsigned int> & size)
+{
+  this->m_ExtractSize = size;
+}
+
+const std::vector<unsigned int> &
+ImageSeriesReader::GetExtractSize() const
+{
+  return this->m_ExtractSize;
+}
+
+void
+ImageSeriesReader::SetExtractIndex(const std::vector<int> & index)
+{
+  this->m_ExtractIndex = index;
+}
+
+const std::vector<int> &
+ImageSeriesReader::GetExtractIndex() const
+{
+  return this->m_ExtractIndex;
+}
+
+void
+ImageSeriesReader::SetNumberOfReadThreads(unsigned int numberOfReadThreads)
+{
+  this->m_NumberOfReadThreads = numberOfReadThreads;
+}
+
+unsigned int
+ImageSeriesReader::GetNumberOfReadThreads() const
+{
+  return this->m_NumberOfReadThreads;
+}
+
 ImageSeriesReader::ImageSeriesReader() = default;
 
 ImageSeriesReader::~ImageSeriesReader() = default;
@@ -174,6 +500,9 @@ ImageSeriesReader::ToString() const
   this->ToStringHelper(out, m_ForceOrthogonalDirection) << std::endl;
   out << "  ReverseOrder: ";
   this->ToStringHelper(out, m_ReverseOrder) << std::endl;
+  out << "  NumberOfReadThreads: " << m_NumberOfReadThreads << std::endl;
+  out << "  ExtractSize: " << this->m_ExtractSize << std::endl;
+  out << "  ExtractIndex: " << this->m_ExtractIndex << std::endl;
 
 
   out << ImageReaderBase::ToString();
@@ -233,6 +562,30 @@ ImageSeriesReader::Execute()
     sitkExceptionMacro("The file in the series have unsupported " << dimension - 1 << " dimensions.");
   }
 
+  const unsigned int seriesDimension = dimension;
+
+  if (!m_ExtractSize.empty())
+  {
+    if (m_ExtractSize.size() > seriesDimension)
+    {
+      sitkExceptionMacro("The extraction size has " << m_ExtractSize.size() << " dimensions, but the series has "
+                                                    << seriesDimension << " dimensions.");
+    }
+
+    dimension = 0;
+    for (unsigned int i = 0; i < m_ExtractSize.size(); ++i)
+    {
+      if (m_ExtractSize[i] != 0)
+      {
+        ++dimension;
+      }
+    }
+    if (dimension < 2)
+    {
+      sitkExceptionMacro("The extraction region has unsupported output dimension of " << dimension << ".");
+    }
+  }
+
   if (!GetMemberFunctionFactory().HasMemberFunction(type, dimension))
   {
     sitkExceptionMacro(<< "PixelType is not supported!" << std::endl
@@ -240,23 +593,14 @@ ImageSeriesReader::Execute()
                        << "Refusing to load! " << std::endl);
   }
 
-  return GetMemberFunctionFactory().GetMemberFunction(type, dimension, this)(imageio);
+  return GetMemberFunctionFactory().GetMemberFunction(type, dimension, this)(imageio, seriesDimension);
 }
 
 
-template <class TImageType>
-Image
-ImageSeriesReader::ExecuteInternal(itk::ImageIOBase * imageio)
+template <class TReader>
+void
+ImageSeriesReader::ConfigureReader(TReader * reader, itk::ImageIOBase * imageio)
 {
-
-  using ImageType = TImageType;
-  using Reader = itk::ImageSeriesReader<ImageType>;
-
-  // if the IsInstantiated is correctly implemented this should
-  // not occur
-  assert(ImageTypeToPixelIDValue<ImageType>::Result != (int)sitkUnknown);
-  assert(imageio != nullptr);
-  typename Reader::Pointer reader = Reader::New();
   reader->SetImageIO(imageio);
   reader->SetFileNames(std::vector<std::string>(this->m_FileNames.begin(), this->m_FileNames.end()));
   reader->SetSpacingWarningRelThreshold(m_SpacingWarningRelThreshold);
@@ -270,30 +614,285 @@ ImageSeriesReader::ExecuteInternal(itk::ImageIOBase * imageio)
   this->m_pfHasMetaDataKey = nullptr;
   this->m_pfGetMetaData = nullptr;
   this->m_Filter = nullptr;
+}
 
 
-  this->PreUpdate(reader.GetPointer());
+template <class TReader>
+void
+ImageSeriesReader::SetMetaDataDictionaryArrayAccess(TReader * reader)
+{
+  using Reader = TReader;
 
   if (m_MetaDataDictionaryArrayUpdate)
   {
     this->m_Filter.reset(reader);
     this->m_Filter->Register();
-    this->m_pfGetMetaDataKeys = [capture0 = reader.GetPointer()](auto && PH1) {
+    this->m_pfGetMetaDataKeys = [capture0 = reader](auto && PH1) {
       return GetMetaDataKeysCustomCast<Reader>::CustomCast(capture0, std::forward<decltype(PH1)>(PH1));
     };
-    this->m_pfHasMetaDataKey = [capture0 = reader.GetPointer()](auto && PH1, auto && PH2) {
+    this->m_pfHasMetaDataKey = [capture0 = reader](auto && PH1, auto && PH2) {
       return HasMetaDataKeyCustomCast<Reader>::CustomCast(
         capture0, std::forward<decltype(PH1)>(PH1), std::forward<decltype(PH2)>(PH2));
     };
-    this->m_pfGetMetaData = [capture0 = reader.GetPointer()](auto && PH1, auto && PH2) {
+    this->m_pfGetMetaData = [capture0 = reader](auto && PH1, auto && PH2) {
       return GetMetaDataCustomCast<Reader>::CustomCast(
         capture0, std::forward<decltype(PH1)>(PH1), std::forward<decltype(PH2)>(PH2));
     };
   }
+}
+
+
+template <class TImageType>
+Image
+ImageSeriesReader::ExecuteInternal(itk::ImageIOBase * imageio, unsigned int seriesDimension)
+{
+
+  using ImageType = TImageType;
+  using Reader = itk::ImageSeriesReader<ImageType>;
+
+  // if the IsInstantiated is correctly implemented this should
+  // not occur
+  assert(ImageTypeToPixelIDValue<ImageType>::Result != (int)sitkUnknown);
+  assert(imageio != nullptr);
+
+  if (!m_ExtractSize.empty())
+  {
+    return this->ExecuteExtract<ImageType, ImageType::ImageDimension>(imageio, seriesDimension);
+  }
+
+  typename Reader::Pointer reader = Reader::New();
+  this->ConfigureReader(reader.GetPointer(), imageio);
+
+  this->PreUpdate(reader.GetPointer());
+
+  if (m_NumberOfReadThreads != 1 && this->m_FileNames.size() > 1)
+  {
+    // The series reader only computes the output information: the
+    // slice ordering, spacing, origin and direction of the output.
+    reader->UpdateOutputInformation();
+    return this->ExecuteInternalParallel<ImageType>(imageio, reader->GetOutput(), reader.GetPointer());
+  }
 
-  reader->Update();
+  this->SetMetaDataDictionaryArrayAccess(reader.GetPointer());
+
+  this->UpdateWithTimeout(reader.GetPointer());
 
   return Image(reader->GetOutput());
 }
 
+
+template <class TImageType, unsigned int VSeriesDimension>
+Image
+ImageSeriesReader::ExecuteExtract(itk::ImageIOBase * imageio, unsigned int seriesDimension)
+{
+  if constexpr (VSeriesDimension < SITK_MAX_DIMENSION)
+  {
+    if (seriesDimension > VSeriesDimension)
+    {
+      return this->ExecuteExtract<TImageType, VSeriesDimension + 1>(imageio, seriesDimension);
+    }
+  }
+
+  using ImageType = TImageType;
+  using SeriesImageType = typename ImageType::template RebindImageType<typename ImageType::PixelType, VSeriesDimension>;
+  using Reader = itk::ImageSeriesReader<SeriesImageType>;
+  using ExtractType = itk::ExtractImageFilter<SeriesImageType, ImageType>;
+
+  typename Reader::Pointer reader = Reader::New();
+  this->ConfigureReader(reader.GetPointer(), imageio);
+
+  typename ExtractType::Pointer extractor = ExtractType::New();
+  extractor->InPlaceOn();
+  extractor->SetDirectionCollapseToSubmatrix();
+  extractor->SetInput(reader->GetOutput());
+
+  reader->UpdateOutputInformation();
+
+  const typename SeriesImageType::RegionType largestRegion = reader->GetOutput()->GetLargestPossibleRegion();
+  typename SeriesImageType::RegionType       region = largestRegion;
+
+  for (unsigned int i = 0; i < VSeriesDimension; ++i)
+  {
+    region.SetSize(i, i < m_ExtractSize.size() ? m_ExtractSize[i] : 0u);
+    if (i < m_ExtractIndex.size())
+    {
+      region.SetIndex(i, m_ExtractIndex[i]);
+    }
+  }
+
+  extractor->SetExtractionRegion(region);
+
+  typename SeriesImageType::IndexType upperIndex = region.GetUpperIndex();
+  for (unsigned int i = 0; i < VSeriesDimension; ++i)
+  {
+    if (region.GetSize(i) == 0)
+    {
+      upperIndex[i] = region.GetIndex(i);
+    }
+  }
+
+  // check region is in largest possible
+  if (!largestRegion.IsInside(region.GetIndex()) || !largestRegion.IsInside(upperIndex))
+  {
+    sitkExceptionMacro("The requested extraction region: " << region << " is not contained with in series' region: "
+                                                           << largestRegion);
+  }
+
+  this->PreUpdate(reader.GetPointer());
+
+  this->SetMetaDataDictionaryArrayAccess(reader.GetPointer());
+
+  // Only the files intersecting the extraction region are read, and
+  // just the in-plane region when the ImageIO supports streaming.
+  this->UpdateWithTimeout(extractor.GetPointer());
+
+  ImageType * itkOutImage = extractor->GetOutput();
+  FixNonZeroIndex(itkOutImage);
+  return Image(itkOutImage);
+}
+
+template <class TImageType>
+Image
+ImageSeriesReader::ExecuteInternalParallel(itk::ImageIOBase *   imageio,
+                                           const TImageType *   info,
+                                           itk::ProcessObject * reader)
+{
+  using ImageType = TImageType;
+  using InternalPixelType = typename ImageType::InternalPixelType;
+  using ComponentType = typename itk::DefaultConvertPixelTraits<InternalPixelType>::ComponentType;
+  constexpr unsigned int ImageDimension = ImageType::ImageDimension;
+
+  typename ImageType::Pointer output = ImageType::New();
+  output->CopyInformation(info);
+  output->SetRegions(info->GetLargestPossibleRegion());
+  output->Allocate();
+
+  const size_t numberOfFiles = this->m_FileNames.size();
+  const size_t slabLength = output->GetPixelContainer()->Size() / numberOfFiles;
+
+  InternalPixelType * buffer = output->GetBufferPointer();
+
+  // the origin of each slice, and the meta-data dictionary of each
+  // slice in the order of the output slices
+  std::vector<std::vector<double>>     sliceOrigins(numberOfFiles);
+  std::vector<itk::MetaDataDictionary> dictionaries(m_MetaDataDictionaryArrayUpdate ? numberOfFiles : 0);
+  unsigned int                         fileDimension = ImageDimension;
+
+  reader->InvokeEvent(itk::StartEvent());
+
+  auto readSlice = [&](size_t slice) {
+    const size_t        fileIndex = (m_ReverseOrder ? numberOfFiles - slice - 1 : slice);
+    const std::string & fileName = this->m_FileNames[fileIndex];
+
+    // each slice is decoded with its own instance of the series ImageIO
+    itk::ImageIOBase::Pointer io = dynamic_cast<itk::ImageIOBase *>(imageio->CreateAnother().GetPointer());
+    if (auto * gdcmIO = dynamic_cast<itk::GDCMImageIO *>(io.GetPointer()))
+    {
+      gdcmIO->SetLoadPrivateTags(this->GetLoadPrivateTags());
+    }
+    io->SetFileName(fileName);
+    io->ReadImageInformation();
+
+    InternalPixelType * slab = buffer + slice * slabLength;
+
+    if (io->GetComponentType() == itk::ImageIOBase::MapPixelType<ComponentType>::CType &&
+        io->GetImageSizeInBytes() == slabLength * sizeof(InternalPixelType))
+    {
+      itk::ImageIORegion ioRegion(io->GetNumberOfDimensions());
+      for (unsigned int d = 0; d < io->GetNumberOfDimensions(); ++d)
+      {
+        ioRegion.SetSize(d, io->GetDimensions(d));
+      }
+      io->SetIORegion(ioRegion);
+      io->Read(slab);
+    }
+    else
+    {
+      // the pixel type of the file needs to be converted
+      auto sliceReader = itk::ImageFileReader<ImageType>::New();
+      sliceReader->SetImageIO(io);
+      sliceReader->SetFileName(fileName);
+      sliceReader->Update();
+
+      const ImageType * sliceImage = sliceReader->GetOutput();
+      if (sliceImage->GetPixelContainer()->Size() != slabLength)
+      {
+        sitkExceptionMacro("The size of the image \"" << fileName << "\" does not match the size of the series.");
+      }
+      std::copy_n(sliceImage->GetBufferPointer(), slabLength, slab);
+    }
+
+    std::vector<double> & origin = sliceOrigins[slice];
+    for (unsigned int d = 0; d < std::min(io->GetNumberOfDimensions(), ImageDimension); ++d)
+    {
+      origin.push_back(io->GetOrigin(d));
+    }
+    origin.resize(ImageDimension, 0.0);
+
+    if (slice == 0)
+    {
+      fileDimension = io->GetNumberOfDimensions();
+    }
+
+    if (m_MetaDataDictionaryArrayUpdate)
+    {
+      dictionaries[slice] = io->GetMetaDataDictionary();
+    }
+  };
+
+  try
+  {
+    this->ParallelizeBatch(numberOfFiles, readSlice, m_NumberOfReadThreads, reader);
+  }
+  catch (...)
+  {
+    // the execution ends when a slice fails, is aborted or times out
+    reader->InvokeEvent(itk::EndEvent());
+    throw;
+  }
+
+  // When the files have a position along the slice dimension,
+  // verify the slices are uniformly spaced as itk::ImageSeriesReader does.
+  if (fileDimension >= ImageDimension)
+  {
+    const double spacing = output->GetSpacing()[ImageDimension - 1];
+    double       maxSpacingDifference = 0.0;
+    for (size_t slice = 1; slice < numberOfFiles; ++slice)
+    {
+      double sliceSpacing = 0.0;
+      for (unsigned int d = 0; d < ImageDimension; ++d)
+      {
+        sliceSpacing += (sliceOrigins[slice][d] - sliceOrigins[slice - 1][d]) *
+                        output->GetDirection()[d][ImageDimension - 1];
+      }
+      maxSpacingDifference = std::max(maxSpacingDifference, std::abs(sliceSpacing - spacing));
+    }
+    if (maxSpacingDifference > m_SpacingWarningRelThreshold * spacing)
+    {
+      sitkWarningMacro("Non uniform sampling or missing slices detected, the maximum nonuniformity of the "
+                       << "slice spacing " << maxSpacingDifference << " is greater than the relative threshold of "
+                       << m_SpacingWarningRelThreshold << ".");
+    }
+  }
+
+  if (m_MetaDataDictionaryArrayUpdate)
+  {
+    this->m_Filter.reset(reader);
+    this->m_Filter->Register();
+
+    auto dictionaryArray = std::make_shared<std::vector<itk::MetaDataDictionary>>(std::move(dictionaries));
+    this->m_pfGetMetaDataKeys = [dictionaryArray](int slice) { return dictionaryArray->at(slice).GetKeys(); };
+    this->m_pfHasMetaDataKey = [dictionaryArray](int slice, const std::string & key) {
+      return dictionaryArray->at(slice).HasKey(key);
+    };
+    this->m_pfGetMetaData = [dictionaryArray](int slice, const std::string & key) {
+      return GetMetaDataDictionaryCustomCast::CustomCast(&dictionaryArray->at(slice), key);
+    };
+  }
+
+  reader->InvokeEvent(itk::EndEvent());
+
+  return Image(output);
+}
+
 } // namespace itk::simple
@@ -26,6 +26,7 @@
 
 #include <itkImageIOBase.h>
 #include <itkImageSeriesWriter.h>
+#include <itkImageFileWriter.h>
 
 #include <cctype>
 #include <memory>
@@ -78,6 +79,8 @@ ImageSeriesWriter::ToString() const
   this->ToStringHelper(out, this->m_Compressor);
   out << std::endl;
 
+  out << "  NumberOfWriteThreads: " << this->m_NumberOfWriteThreads << std::endl;
+
   out << "  FileNames:" << std::endl;
   for (auto v : m_FileNames)
   {
@@ -171,6 +174,18 @@ ImageSeriesWriter::GetCompressor()
   return m_Compressor;
 }
 
+void
+ImageSeriesWriter::SetNumberOfWriteThreads(unsigned int numberOfWriteThreads)
+{
+  this->m_NumberOfWriteThreads = numberOfWriteThreads;
+}
+
+unsigned int
+ImageSeriesWriter::GetNumberOfWriteThreads() const
+{
+  return this->m_NumberOfWriteThreads;
+}
+
 
 void
 ImageSeriesWriter::SetFileNames(const std::vector<PathType> & filenames)
@@ -265,7 +280,108 @@ ImageSeriesWriter::ExecuteInternal(const Image & inImage)
 
   this->PreUpdate(writer.GetPointer());
 
-  writer->Update();
+  if (m_NumberOfWriteThreads != 1 && this->m_FileNames.size() > 1)
+  {
+    this->ExecuteInternalParallel<InputImageType>(image, imageio, writer.GetPointer());
+    return;
+  }
+
+  this->UpdateWithTimeout(writer.GetPointer());
+}
+
+
+template <class TImageType>
+void
+ImageSeriesWriter::ExecuteInternalParallel(const TImageType *   image,
+                                           ImageIOBase *        imageio,
+                                           itk::ProcessObject * writer)
+{
+  using InputImageType = TImageType;
+  using SliceImageType = typename InputImageType::template RebindImageType<typename InputImageType::PixelType,
+                                                                            InputImageType::ImageDimension - 1>;
+  using InternalPixelType = typename InputImageType::InternalPixelType;
+  constexpr unsigned int SliceDimension = SliceImageType::ImageDimension;
+
+  const typename InputImageType::RegionType & region = image->GetBufferedRegion();
+
+  const size_t numberOfSlices = region.GetSize(SliceDimension);
+  if (numberOfSlices != this->m_FileNames.size())
+  {
+    sitkExceptionMacro("The number of file names " << this->m_FileNames.size()
+                                                   << " does not match the number of slices " << numberOfSlices << ".");
+  }
+
+  // the slices share the in-plane geometry of the image
+  typename SliceImageType::RegionType    sliceRegion;
+  typename SliceImageType::SpacingType   spacing;
+  typename SliceImageType::DirectionType direction;
+  for (unsigned int i = 0; i < SliceDimension; ++i)
+  {
+    sliceRegion.SetSize(i, region.GetSize(i));
+    spacing[i] = image->GetSpacing()[i];
+    for (unsigned int j = 0; j < SliceDimension; ++j)
+    {
+      direction[i][j] = image->GetDirection()[i][j];
+    }
+  }
+
+  const size_t              slabLength = image->GetPixelContainer()->Size() / numberOfSlices;
+  InternalPixelType * const buffer = const_cast<InternalPixelType *>(image->GetBufferPointer());
+
+  writer->InvokeEvent(itk::StartEvent());
+
+  auto writeSlice = [&](size_t slice) {
+    typename InputImageType::IndexType index = region.GetIndex();
+    index[SliceDimension] += slice;
+    typename InputImageType::PointType point;
+    image->TransformIndexToPhysicalPoint(index, point);
+
+    typename SliceImageType::PointType origin;
+    for (unsigned int i = 0; i < SliceDimension; ++i)
+    {
+      origin[i] = point[i];
+    }
+
+    // the slice image references its slab of the image buffer
+    auto sliceImage = SliceImageType::New();
+    sliceImage->SetRegions(sliceRegion);
+    sliceImage->SetNumberOfComponentsPerPixel(image->GetNumberOfComponentsPerPixel());
+    sliceImage->SetSpacing(spacing);
+    sliceImage->SetOrigin(origin);
+    sliceImage->SetDirection(direction);
+    sliceImage->GetPixelContainer()->SetImportPointer(buffer + slice * slabLength, slabLength, false);
+
+    // each slice is encoded with its own instance of the ImageIO
+    itk::ImageIOBase::Pointer io = dynamic_cast<itk::ImageIOBase *>(imageio->CreateAnother().GetPointer());
+    if (!this->m_Compressor.empty())
+    {
+      io->SetCompressor(this->m_Compressor);
+    }
+    if (this->m_CompressionLevel != -1)
+    {
+      io->SetCompressionLevel(this->m_CompressionLevel);
+    }
+
+    auto sliceWriter = itk::ImageFileWriter<SliceImageType>::New();
+    sliceWriter->SetInput(sliceImage);
+    sliceWriter->SetImageIO(io);
+    sliceWriter->SetFileName(this->m_FileNames[slice]);
+    sliceWriter->SetUseCompression(this->m_UseCompression);
+    sliceWriter->Update();
+  };
+
+  try
+  {
+    this->ParallelizeBatch(numberOfSlices, writeSlice, m_NumberOfWriteThreads, writer);
+  }
+  catch (...)
+  {
+    // the execution ends when a slice fails, is aborted or times out
+    writer->InvokeEvent(itk::EndEvent());
+    throw;
+  }
+
+  writer->InvokeEvent(itk::EndEvent());
 }
 
 } // namespace itk::simple
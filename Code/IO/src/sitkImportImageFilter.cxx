@@ -24,6 +24,7 @@
 
 #include <itkImage.h>
 #include <itkVectorImage.h>
+#include <itkDeleterImportImageContainer.h>
 
 #include <iterator>
 #include <memory>
@@ -35,7 +36,17 @@ namespace itk::simple
 namespace
 {
 constexpr unsigned int UnusedDimension = 2;
+
+std::shared_ptr<void>
+MakeBufferOwner(void * buffer, ImportImageFilter::BufferDeleterType deleter)
+{
+  if (!deleter)
+  {
+    sitkExceptionMacro(<< "The buffer deleter must not be empty.");
+  }
+  return std::shared_ptr<void>(buffer, std::move(deleter));
 }
+} // namespace
 
 
 Image
@@ -272,146 +283,143 @@ ImportImageFilter::GetDirection() const
   return this->m_Direction;
 }
 
+template <typename TPixelType>
 void
-ImportImageFilter::SetBufferAsInt8(int8_t * buffer, unsigned int numberOfComponents)
+ImportImageFilter::InternalSetBuffer(TPixelType * buffer, unsigned int numberOfComponents)
 {
   this->m_Buffer = buffer;
   this->m_NumberOfComponentsPerPixel = numberOfComponents;
   if (this->m_NumberOfComponentsPerPixel == 1)
   {
-    this->m_PixelIDValue = ImageTypeToPixelIDValue<itk::Image<int8_t, UnusedDimension>>::Result;
+    this->m_PixelIDValue = ImageTypeToPixelIDValue<itk::Image<TPixelType, UnusedDimension>>::Result;
   }
   else
   {
-    this->m_PixelIDValue = ImageTypeToPixelIDValue<itk::VectorImage<int8_t, UnusedDimension>>::Result;
+    this->m_PixelIDValue = ImageTypeToPixelIDValue<itk::VectorImage<TPixelType, UnusedDimension>>::Result;
   }
 }
+
+void
+ImportImageFilter::SetBufferAsInt8(int8_t * buffer, unsigned int numberOfComponents)
+{
+  this->m_BufferOwner.reset();
+  this->InternalSetBuffer(buffer, numberOfComponents);
+}
 void
 ImportImageFilter::SetBufferAsUInt8(uint8_t * buffer, unsigned int numberOfComponents)
 {
-  this->m_Buffer = buffer;
-  this->m_NumberOfComponentsPerPixel = numberOfComponents;
-  if (this->m_NumberOfComponentsPerPixel == 1)
-  {
-    this->m_PixelIDValue = ImageTypeToPixelIDValue<itk::Image<uint8_t, UnusedDimension>>::Result;
-  }
-  else
-  {
-    this->m_PixelIDValue = ImageTypeToPixelIDValue<itk::VectorImage<uint8_t, UnusedDimension>>::Result;
-  }
+  this->m_BufferOwner.reset();
+  this->InternalSetBuffer(buffer, numberOfComponents);
 }
 void
 ImportImageFilter::SetBufferAsInt16(int16_t * buffer, unsigned int numberOfComponents)
 {
-  this->m_Buffer = buffer;
-  this->m_NumberOfComponentsPerPixel = numberOfComponents;
-  if (this->m_NumberOfComponentsPerPixel == 1)
-  {
-    this->m_PixelIDValue = ImageTypeToPixelIDValue<itk::Image<int16_t, UnusedDimension>>::Result;
-  }
-  else
-  {
-    this->m_PixelIDValue = ImageTypeToPixelIDValue<itk::VectorImage<int16_t, UnusedDimension>>::Result;
-  }
+  this->m_BufferOwner.reset();
+  this->InternalSetBuffer(buffer, numberOfComponents);
 }
 void
 ImportImageFilter::SetBufferAsUInt16(uint16_t * buffer, unsigned int numberOfComponents)
 {
-  this->m_Buffer = buffer;
-  this->m_NumberOfComponentsPerPixel = numberOfComponents;
-  if (this->m_NumberOfComponentsPerPixel == 1)
-  {
-    this->m_PixelIDValue = ImageTypeToPixelIDValue<itk::Image<uint16_t, UnusedDimension>>::Result;
-  }
-  else
-  {
-    this->m_PixelIDValue = ImageTypeToPixelIDValue<itk::VectorImage<uint16_t, UnusedDimension>>::Result;
-  }
+  this->m_BufferOwner.reset();
+  this->InternalSetBuffer(buffer, numberOfComponents);
 }
 void
 ImportImageFilter::SetBufferAsInt32(int32_t * buffer, unsigned int numberOfComponents)
 {
-  this->m_Buffer = buffer;
-  this->m_NumberOfComponentsPerPixel = numberOfComponents;
-  if (this->m_NumberOfComponentsPerPixel == 1)
-  {
-    this->m_PixelIDValue = ImageTypeToPixelIDValue<itk::Image<int32_t, UnusedDimension>>::Result;
-  }
-  else
-  {
-    this->m_PixelIDValue = ImageTypeToPixelIDValue<itk::VectorImage<int32_t, UnusedDimension>>::Result;
-  }
+  this->m_BufferOwner.reset();
+  this->InternalSetBuffer(buffer, numberOfComponents);
 }
 void
 ImportImageFilter::SetBufferAsUInt32(uint32_t * buffer, unsigned int numberOfComponents)
 {
-  this->m_Buffer = buffer;
-  this->m_NumberOfComponentsPerPixel = numberOfComponents;
-  if (this->m_NumberOfComponentsPerPixel == 1)
-  {
-    this->m_PixelIDValue = ImageTypeToPixelIDValue<itk::Image<uint32_t, UnusedDimension>>::Result;
-  }
-  else
-  {
-    this->m_PixelIDValue = ImageTypeToPixelIDValue<itk::VectorImage<uint32_t, UnusedDimension>>::Result;
-  }
+  this->m_BufferOwner.reset();
+  this->InternalSetBuffer(buffer, numberOfComponents);
 }
 void
 ImportImageFilter::SetBufferAsInt64(int64_t * buffer, unsigned int numberOfComponents)
 {
-  this->m_Buffer = buffer;
-  this->m_NumberOfComponentsPerPixel = numberOfComponents;
-  if (this->m_NumberOfComponentsPerPixel == 1)
-  {
-    this->m_PixelIDValue = ImageTypeToPixelIDValue<itk::Image<int64_t, UnusedDimension>>::Result;
-  }
-  else
-  {
-    this->m_PixelIDValue = ImageTypeToPixelIDValue<itk::VectorImage<int64_t, UnusedDimension>>::Result;
-  }
+  this->m_BufferOwner.reset();
+  this->InternalSetBuffer(buffer, numberOfComponents);
 }
 void
 ImportImageFilter::SetBufferAsUInt64(uint64_t * buffer, unsigned int numberOfComponents)
 {
-  this->m_Buffer = buffer;
-  this->m_NumberOfComponentsPerPixel = numberOfComponents;
-  if (this->m_NumberOfComponentsPerPixel == 1)
-  {
-    this->m_PixelIDValue = ImageTypeToPixelIDValue<itk::Image<uint64_t, UnusedDimension>>::Result;
-  }
-  else
-  {
-    this->m_PixelIDValue = ImageTypeToPixelIDValue<itk::VectorImage<uint64_t, UnusedDimension>>::Result;
-  }
+  this->m_BufferOwner.reset();
+  this->InternalSetBuffer(buffer, numberOfComponents);
 }
 
 void
 ImportImageFilter::SetBufferAsFloat(float * buffer, unsigned int numberOfComponents)
 {
-  this->m_Buffer = buffer;
-  this->m_NumberOfComponentsPerPixel = numberOfComponents;
-  if (this->m_NumberOfComponentsPerPixel == 1)
-  {
-    this->m_PixelIDValue = ImageTypeToPixelIDValue<itk::Image<float, UnusedDimension>>::Result;
-  }
-  else
-  {
-    this->m_PixelIDValue = ImageTypeToPixelIDValue<itk::VectorImage<float, UnusedDimension>>::Result;
-  }
+  this->m_BufferOwner.reset();
+  this->InternalSetBuffer(buffer, numberOfComponents);
 }
 void
 ImportImageFilter::SetBufferAsDouble(double * buffer, unsigned int numberOfComponents)
 {
-  this->m_Buffer = buffer;
-  this->m_NumberOfComponentsPerPixel = numberOfComponents;
-  if (this->m_NumberOfComponentsPerPixel == 1)
-  {
-    this->m_PixelIDValue = ImageTypeToPixelIDValue<itk::Image<double, UnusedDimension>>::Result;
-  }
-  else
-  {
-    this->m_PixelIDValue = ImageTypeToPixelIDValue<itk::VectorImage<double, UnusedDimension>>::Result;
-  }
+  this->m_BufferOwner.reset();
+  this->InternalSetBuffer(buffer, numberOfComponents);
+}
+
+void
+ImportImageFilter::SetBufferAsInt8(int8_t * buffer, BufferDeleterType deleter, unsigned int numberOfComponents)
+{
+  this->m_BufferOwner = MakeBufferOwner(buffer, std::move(deleter));
+  this->InternalSetBuffer(buffer, numberOfComponents);
+}
+void
+ImportImageFilter::SetBufferAsUInt8(uint8_t * buffer, BufferDeleterType deleter, unsigned int numberOfComponents)
+{
+  this->m_BufferOwner = MakeBufferOwner(buffer, std::move(deleter));
+  this->InternalSetBuffer(buffer, numberOfComponents);
+}
+void
+ImportImageFilter::SetBufferAsInt16(int16_t * buffer, BufferDeleterType deleter, unsigned int numberOfComponents)
+{
+  this->m_BufferOwner = MakeBufferOwner(buffer, std::move(deleter));
+  this->InternalSetBuffer(buffer, numberOfComponents);
+}
+void
+ImportImageFilter::SetBufferAsUInt16(uint16_t * buffer, BufferDeleterType deleter, unsigned int numberOfComponents)
+{
+  this->m_BufferOwner = MakeBufferOwner(buffer, std::move(deleter));
+  this->InternalSetBuffer(buffer, numberOfComponents);
+}
+void
+ImportImageFilter::SetBufferAsInt32(int32_t * buffer, BufferDeleterType deleter, unsigned int numberOfComponents)
+{
+  this->m_BufferOwner = MakeBufferOwner(buffer, std::move(deleter));
+  this->InternalSetBuffer(buffer, numberOfComponents);
+}
+void
+ImportImageFilter::SetBufferAsUInt32(uint32_t * buffer, BufferDeleterType deleter, unsigned int numberOfComponents)
+{
+  this->m_BufferOwner = MakeBufferOwner(buffer, std::move(deleter));
+  this->InternalSetBuffer(buffer, numberOfComponents);
+}
+void
+ImportImageFilter::SetBufferAsInt64(int64_t * buffer, BufferDeleterType deleter, unsigned int numberOfComponents)
+{
+  this->m_BufferOwner = MakeBufferOwner(buffer, std::move(deleter));
+  this->InternalSetBuffer(buffer, numberOfComponents);
+}
+void
+ImportImageFilter::SetBufferAsUInt64(uint64_t * buffer, BufferDeleterType deleter, unsigned int numberOfComponents)
+{
+  this->m_BufferOwner = MakeBufferOwner(buffer, std::move(deleter));
+  this->InternalSetBuffer(buffer, numberOfComponents);
+}
+void
+ImportImageFilter::SetBufferAsFloat(float * buffer, BufferDeleterType deleter, unsigned int numberOfComponents)
+{
+  this->m_BufferOwner = MakeBufferOwner(buffer, std::move(deleter));
+  this->InternalSetBuffer(buffer, numberOfComponents);
+}
+void
+ImportImageFilter::SetBufferAsDouble(double * buffer, BufferDeleterType deleter, unsigned int numberOfComponents)
+{
+  this->m_BufferOwner = MakeBufferOwner(buffer, std::move(deleter));
+  this->InternalSetBuffer(buffer, numberOfComponents);
 }
 
 
@@ -425,7 +433,8 @@ ImportImageFilter::ToString() const
   out << "itk::simple::ImportImageFilter\n"
       << PRINT_IVAR_MACRO(m_NumberOfComponentsPerPixel) << PRINT_IVAR_MACRO(m_PixelIDValue)
       << PRINT_IVAR_MACRO(m_Origin) << PRINT_IVAR_MACRO(m_Spacing) << PRINT_IVAR_MACRO(m_Size)
-      << PRINT_IVAR_MACRO(m_Direction) << PRINT_IVAR_MACRO(m_Buffer);
+      << PRINT_IVAR_MACRO(m_Direction) << PRINT_IVAR_MACRO(m_Buffer)
+      << "\tm_BufferOwner: " << (this->m_BufferOwner ? "true" : "false") << std::endl;
   return out.str();
 }
 
@@ -504,24 +513,45 @@ ImportImageFilter::ExecuteInternal()
   }
 
 
-  size_t numberOfElements = m_NumberOfComponentsPerPixel;
+  // The members are cleared when the ownership of the buffer is transferred.
+  const unsigned int numberOfComponents = m_NumberOfComponentsPerPixel;
+
+  size_t numberOfElements = numberOfComponents;
   for (unsigned int si = 0; si < Dimension; si++)
   {
     numberOfElements *= size[si];
   }
 
-  const bool TheContainerWillTakeCareOfDeletingTheMemoryBuffer = false;
+  if (this->m_BufferOwner)
+  {
+    // Transfer the ownership of the buffer to the image's pixel
+    // container, the buffer is released with the last reference.
+    using ContainerType = itk::DeleterImportImageContainer<itk::SizeValueType, typename ImageType::InternalPixelType>;
+    auto container = ContainerType::New();
+    container->SetImportPointer(static_cast<typename ImageType::InternalPixelType *>(m_Buffer),
+                                numberOfElements,
+                                [owner = std::move(this->m_BufferOwner)](void *) mutable { owner.reset(); });
+    image->SetPixelContainer(container);
+
+    this->m_Buffer = nullptr;
+    this->m_NumberOfComponentsPerPixel = 0;
+    this->m_PixelIDValue = sitkUnknown;
+  }
+  else
+  {
+    const bool TheContainerWillTakeCareOfDeletingTheMemoryBuffer = false;
 
-  // Set the image's pixel container to import the pointer provided.
-  image->GetPixelContainer()->SetImportPointer(static_cast<typename ImageType::InternalPixelType *>(m_Buffer),
-                                               numberOfElements,
-                                               TheContainerWillTakeCareOfDeletingTheMemoryBuffer);
+    // Set the image's pixel container to import the pointer provided.
+    image->GetPixelContainer()->SetImportPointer(static_cast<typename ImageType::InternalPixelType *>(m_Buffer),
+                                                 numberOfElements,
+                                                 TheContainerWillTakeCareOfDeletingTheMemoryBuffer);
+  }
 
 
   // set the number of components if a vector image
   if constexpr (IsVector<ImageType>::Value)
   {
-    image->SetNumberOfComponentsPerPixel(m_NumberOfComponentsPerPixel);
+    image->SetNumberOfComponentsPerPixel(numberOfComponents);
   }
 
   // This line must be the last line in the function to prevent a deep
@@ -22,6 +22,7 @@
 
 #include "sitkDetail.h"
 #include "sitkImage.h"
+#include "sitkBinaryMask.h"
 #include "sitkPixelIDTokens.h"
 #include "sitkMemberFunctionFactory.h"
 #include "sitkProcessObject.h"
@@ -527,6 +528,18 @@ public:
   void
   SetMetricMovingMask(const Image & binaryMask);
 
+  /** \brief Set a bit packed mask in order to restrict the sampled
+   * points for the metric.
+   *
+   * The mask is converted to a sitkUInt8 image.
+   * @{
+   */
+  void
+  SetMetricFixedMask(const BinaryMask & binaryMask);
+  void
+  SetMetricMovingMask(const BinaryMask & binaryMask);
+  /** @} */
+
   /** \brief Set percentage of pixels sampled for metric evaluation.
    *
    * The percentage is of the number of pixels in the virtual domain
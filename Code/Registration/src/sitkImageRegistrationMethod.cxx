@@ -21,6 +21,7 @@
 
 #include "sitkCreateInterpolator.hxx"
 #include "sitkCastImageFilter.h"
+#include "sitkExecutionTrace.h"
 
 #include "itkImageMaskSpatialObject.h"
 #include "itkImage.h"
@@ -459,6 +460,18 @@ ImageRegistrationMethod::SetMetricMovingMask(const Image & binaryMask)
   // m_MetricMovingMaskRegion.clear();
 }
 
+void
+ImageRegistrationMethod::SetMetricFixedMask(const BinaryMask & binaryMask)
+{
+  this->SetMetricFixedMask(binaryMask.ToImage());
+}
+
+void
+ImageRegistrationMethod::SetMetricMovingMask(const BinaryMask & binaryMask)
+{
+  this->SetMetricMovingMask(binaryMask.ToImage());
+}
+
 void
 ImageRegistrationMethod::SetOptimizerScalesFromJacobian(unsigned int centralRegionRadius)
 {
@@ -937,7 +950,7 @@ ImageRegistrationMethod::ExecuteInternal(const Image & inFixed, const Image & in
 
   try
   {
-    registration->Update();
+    this->UpdateWithTimeout(registration.GetPointer());
   }
   catch (std::exception & e)
   {
@@ -1173,6 +1186,74 @@ void
 ImageRegistrationMethod::PreUpdate(itk::ProcessObject * p)
 {
   Superclass::PreUpdate(p);
+
+  // The optimizers do not check for abort, the optimization is
+  // stopped at the next iteration after the timeout expired, and the
+  // TimeoutException is thrown when the registration returns. The
+  // optimizers which can not be stopped are interrupted by the
+  // exception.
+  if (this->GetExecutionTimeout() > 0.0 && this->m_ActiveOptimizer)
+  {
+    this->m_ActiveOptimizer->AddObserver(GetITKEventObject(sitkIterationEvent), [this](const itk::EventObject &) {
+      if (this->IsExecutionTimeoutExpired() && !this->StopRegistration())
+      {
+        this->CheckExecutionTimeout();
+      }
+    });
+  }
+
+  if (!IsExecutionTraceEnabled() || !this->m_ActiveOptimizer)
+  {
+    return;
+  }
+
+  // Add spans to the execution trace for each resolution level and
+  // optimizer iteration.
+  struct TraceState
+  {
+    double m_LevelStartTime{ -1.0 };
+    double m_IterationStartTime{ 0.0 };
+  };
+  auto state = std::make_shared<TraceState>();
+  state->m_IterationStartTime = GetExecutionTraceTime();
+
+  auto endLevel = [this, state](double now) {
+    if (state->m_LevelStartTime >= 0.0)
+    {
+      AddExecutionTraceEvent("Level",
+                             "Registration",
+                             state->m_LevelStartTime,
+                             now,
+                             { { "Level", std::to_string(this->GetCurrentLevel()) },
+                               { "OptimizerIteration", std::to_string(this->GetOptimizerIteration()) },
+                               { "MetricValue", std::to_string(this->GetMetricValue()) } });
+    }
+  };
+
+  p->AddObserver(GetITKEventObject(sitkMultiResolutionIterationEvent),
+                 [state, endLevel](const itk::EventObject &) {
+                   const double now = GetExecutionTraceTime();
+                   endLevel(now);
+                   state->m_LevelStartTime = now;
+                   state->m_IterationStartTime = now;
+                 });
+  p->AddObserver(GetITKEventObject(sitkEndEvent), [state, endLevel](const itk::EventObject &) {
+    endLevel(GetExecutionTraceTime());
+    state->m_LevelStartTime = -1.0;
+  });
+
+  this->m_ActiveOptimizer->AddObserver(
+    GetITKEventObject(sitkIterationEvent), [this, state](const itk::EventObject &) {
+      const double now = GetExecutionTraceTime();
+      AddExecutionTraceEvent("Iteration",
+                             "Registration",
+                             state->m_IterationStartTime,
+                             now,
+                             { { "Level", std::to_string(this->GetCurrentLevel()) },
+                               { "OptimizerIteration", std::to_string(this->GetOptimizerIteration()) },
+                               { "MetricValue", std::to_string(this->GetMetricValue()) } });
+      state->m_IterationStartTime = now;
+    });
 }
 
 
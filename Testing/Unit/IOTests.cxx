@@ -23,6 +23,8 @@
 
 TEST(IO, ImageFileReader)
 {
+  SITK_SKIP_IF_NOT_INSTANTIATED(itk::simple::sitkInt16);
+
   itk::simple::HashImageFilter hasher;
   itk::simple::ImageFileReader reader;
 
@@ -59,6 +61,8 @@ TEST(IO, ImageFileReader)
 
 TEST(IO, ReadWrite)
 {
+  SITK_SKIP_IF_NOT_INSTANTIATED(itk::simple::sitkInt16);
+
   itk::simple::HashImageFilter hasher;
   itk::simple::ImageFileReader reader;
   itk::simple::ImageFileWriter writer;
@@ -106,3 +106,31 @@ def test_getgdcmseries(test_dir, num_studies, num_series, num_images):
     # Verify all expected series were found, regardless of order
     assert sorted(expected_series) == sorted(found_series), \
         "Found series IDs do not match expected series IDs"
+
+
+def test_scandicomdirectory(test_dir):
+    """Test that the series returned by ImageSeriesReader_ScanDICOMDirectory are wrapped.
+
+    The series are compared to those of GetGDCMSeriesIDs and GetGDCMSeriesFileNames,
+    and the requested tags are returned for each file.
+    """
+    series_uids = create_study_images(test_dir, "1", 2, 3)
+
+    series = sitk.ImageSeriesReader.ScanDICOMDirectory(str(test_dir), ["0020|0013"])
+
+    assert isinstance(series, sitk.DICOMSeriesMap)
+    assert sorted(series.keys()) == sorted(series_uids)
+    assert sorted(series.keys()) == sorted(sitk.ImageSeriesReader.GetGDCMSeriesIDs(str(test_dir)))
+
+    for uid in series_uids:
+        s = series[uid]
+        assert isinstance(s, sitk.DICOMSeries)
+        assert list(s.FileNames) == list(sitk.ImageSeriesReader.GetGDCMSeriesFileNames(str(test_dir), uid))
+        assert len(s.MetaData) == 3
+        assert [m["0020|0013"].strip() for m in s.MetaData] == ["1", "2", "3"]
+
+    # The returned file names are read as a series
+    reader = sitk.ImageSeriesReader()
+    reader.SetFileNames(series[series_uids[0]].FileNames)
+    image = reader.Execute()
+    assert image.GetSize() == (2, 2, 3)
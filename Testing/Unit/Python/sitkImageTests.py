@@ -552,6 +552,24 @@ def test_masked_assign_constant():
         assert image["test"] == "value"
 
 
+def test_memory_statistics():
+    initial = sitk.GetImageMemoryStatistics()
+
+    image = sitk.Image([16, 16, 4], sitk.sitkUInt16)
+    stats = sitk.GetImageMemoryStatistics()
+    assert stats.LiveBytes == initial.LiveBytes + 16 * 16 * 4 * 2
+    assert stats.LiveBytesPerPixelID[sitk.sitkUInt16] == initial.LiveBytesPerPixelID[sitk.sitkUInt16] + 16 * 16 * 4 * 2
+    assert stats.PeakBytes >= stats.LiveBytes
+
+    del image
+    stats = sitk.GetImageMemoryStatistics()
+    assert stats.LiveBytes == initial.LiveBytes
+
+    sitk.ResetImageMemoryPeak()
+    stats = sitk.GetImageMemoryStatistics()
+    assert stats.PeakBytes == stats.LiveBytes
+
+
 def test_legacy():
     """This is old testing cruft before unittest"""
 
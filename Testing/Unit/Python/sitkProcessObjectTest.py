@@ -108,3 +108,23 @@ def test_ProcessObject_PyCommand():
     # Second execution - progress should not be updated
     f.Execute(sitk.Image(10, 10, sitk.sitkFloat32))
     assert progress[0] == 0.0, "Progress should remain 0.0 after command deletion"
+
+
+def test_ProcessObject_ExecutionTimeout():
+    """Test an execution exceeding the timeout raises a TimeoutError"""
+    img = sitk.Image(64, 64, 64, sitk.sitkUInt8)
+    img[32, 32, 32] = 1
+
+    f = sitk.SignedMaurerDistanceMapImageFilter()
+    expected_hash = sitk.Hash(f.Execute(img))
+
+    f.SetExecutionTimeout(1e-9)
+    with pytest.raises(TimeoutError, match="timeout"):
+        f.Execute(img)
+
+    # other errors are not timeouts
+    with pytest.raises(RuntimeError):
+        f.Execute(sitk.Image(4, 4, sitk.sitkLabelUInt8))
+
+    f.SetExecutionTimeout(0.0)
+    assert sitk.Hash(f.Execute(img)) == expected_hash
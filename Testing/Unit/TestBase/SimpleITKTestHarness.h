@@ -324,6 +324,20 @@ VectorRMSPredFormat(const char *            expr1,
  */
 #define EXPECT_VECTOR_NEAR(val1, val2, rms_error) EXPECT_PRED_FORMAT3(VectorRMSPredFormat, val1, val2, rms_error)
 
+/** Skip the test when one of the pixel ids is not instantiated, as
+ * with the SimpleITK_PIXEL_TYPES build profile or without
+ * SimpleITK_INT64_PIXELIDS. The pixel ids which are not instantiated
+ * have the value sitkUnknown.
+ */
+#define SITK_SKIP_IF_NOT_INSTANTIATED(...)                                              \
+  for (const itk::simple::PixelIDValueEnum skipPixelID : { __VA_ARGS__ })               \
+  {                                                                                     \
+    if (skipPixelID == itk::simple::sitkUnknown)                                        \
+    {                                                                                   \
+      GTEST_SKIP() << "A pixel type of " #__VA_ARGS__ " is not instantiated.";          \
+    }                                                                                   \
+  }
+
 
 #include "sitkImageCompare.h"
 
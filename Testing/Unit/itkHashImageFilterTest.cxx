@@ -171,6 +171,7 @@ TEST_F(HashImageFilterTest, VectorImages)
 
 TEST_F(HashImageFilterTest, LabelMap)
 {
+  SITK_SKIP_IF_NOT_INSTANTIATED(itk::simple::sitkLabelUInt16);
 
   itk::simple::Image img = itk::simple::ReadImage(dataFinder.GetFile("Input/2th_cthead1.png"));
 
@@ -27,9 +27,18 @@
 #include <sitkVersionConfig.h>
 #include <itkConfigure.h>
 #include "sitkLogger.h"
+#include "sitkPixelBufferAllocator.h"
+#include "sitkBinaryMask.h"
+#include "sitkExecutionTrace.h"
+#include "sitkMemberFunctionFactory.h"
+#include <chrono>
 #include <cctype>
+#include <fstream>
+#include <sstream>
+#include <unordered_map>
 
 #include "itkMacro.h"
+#include "itkImage.h"
 
 TEST(VersionTest, VersionTest)
 {
@@ -339,6 +348,8 @@ TEST(ProcessObject, Command_Add_lambda)
 
 TEST(ProcessObject, DeleteCommandActiveProcess)
 {
+  SITK_SKIP_IF_NOT_INSTANTIATED(itk::simple::sitkUInt16);
+
   // Test the case of deleting the command while the process is active.
   namespace sitk = itk::simple;
 
@@ -383,6 +394,8 @@ TEST(ProcessObject, DeleteCommandActiveProcess)
 
 TEST(ProcessObject, RemoveAllCommandsActiveProcess)
 {
+  SITK_SKIP_IF_NOT_INSTANTIATED(itk::simple::sitkUInt16);
+
   // Test the case of deleting the command while the process is active.
   namespace sitk = itk::simple;
 
@@ -483,6 +496,8 @@ TEST(Command, Test1)
 
 TEST(ProcessObject, Command_Ownership)
 {
+  SITK_SKIP_IF_NOT_INSTANTIATED(itk::simple::sitkUInt16);
+
   // Test the functionality of the ProcessObject Owning the Command
   namespace sitk = itk::simple;
 
@@ -607,6 +622,94 @@ TEST(ProcessObject, Threads)
   EXPECT_EQ("POOL", strupper(sitk::ProcessObject::GetGlobalDefaultThreader()));
 }
 
+TEST(ProcessObject, ExecutionStatistics)
+{
+  namespace sitk = itk::simple;
+
+  sitk::ProcessObject::ResetGlobalExecutionStatistics();
+
+  sitk::CastImageFilter caster;
+  EXPECT_EQ("", caster.GetLastExecutionStatistics().Name);
+  EXPECT_EQ(0u, caster.GetLastExecutionStatistics().OutputBytes);
+
+  sitk::Image image(64, 32, sitk::sitkFloat32);
+  caster.SetOutputPixelType(sitk::sitkUInt8);
+  sitk::Image output = caster.Execute(image);
+
+  sitk::ExecutionStatistics stats = caster.GetLastExecutionStatistics();
+  EXPECT_EQ(caster.GetName(), stats.Name);
+  EXPECT_LE(0.0, stats.WallTime);
+  EXPECT_LE(0.0, stats.CPUTime);
+  EXPECT_LE(1u, stats.NumberOfThreads);
+  EXPECT_EQ(64u * 32u * sizeof(float), stats.InputBytes);
+  EXPECT_EQ(64u * 32u, stats.OutputBytes);
+  EXPECT_EQ(64u * 32u, stats.AllocatedBytes);
+
+  sitk::Image vectorImage(64, 32, sitk::sitkVectorInt16, 3);
+  caster.SetOutputPixelType(sitk::sitkVectorFloat64);
+  output = caster.Execute(vectorImage);
+  stats = caster.GetLastExecutionStatistics();
+  EXPECT_EQ(64u * 32u * 3u * sizeof(int16_t), stats.InputBytes);
+  EXPECT_EQ(64u * 32u * 3u * sizeof(double), stats.OutputBytes);
+
+  std::vector<sitk::ExecutionStatisticsSummary> summaries = sitk::ProcessObject::GetGlobalExecutionStatistics();
+  ASSERT_EQ(1u, summaries.size());
+  EXPECT_EQ(caster.GetName(), summaries[0].Name);
+  EXPECT_EQ(2u, summaries[0].NumberOfExecutions);
+  EXPECT_LE(summaries[0].MaximumWallTime, summaries[0].TotalWallTime);
+  EXPECT_EQ(64u * 32u * (sizeof(float) + 3u * sizeof(int16_t)), summaries[0].TotalInputBytes);
+  EXPECT_EQ(64u * 32u * (1u + 3u * sizeof(double)), summaries[0].TotalAllocatedBytes);
+
+  sitk::ProcessObject::ResetGlobalExecutionStatistics();
+  EXPECT_TRUE(sitk::ProcessObject::GetGlobalExecutionStatistics().empty());
+}
+
+TEST(ProcessObject, ExecutionTrace)
+{
+  namespace sitk = itk::simple;
+
+  SITK_SKIP_IF_NOT_INSTANTIATED(sitk::sitkUInt16);
+
+  EXPECT_FALSE(sitk::IsExecutionTraceEnabled());
+
+  sitk::Image image(32, 32, sitk::sitkFloat32);
+  sitk::Cast(image, sitk::sitkUInt8);
+
+  sitk::StartExecutionTrace();
+  EXPECT_TRUE(sitk::IsExecutionTraceEnabled());
+  sitk::Cast(image, sitk::sitkInt16);
+  {
+    sitk::ExecutionTraceScope scope("Scope \"quoted\"", "Test");
+  }
+  sitk::StopExecutionTrace();
+  EXPECT_FALSE(sitk::IsExecutionTraceEnabled());
+  sitk::Cast(image, sitk::sitkUInt16);
+
+  const std::string fileName = dataFinder.GetOutputFile("ProcessObject.ExecutionTrace.json");
+  sitk::WriteExecutionTrace(fileName);
+
+  std::ifstream     in(fileName.c_str());
+  std::stringstream buffer;
+  buffer << in.rdbuf();
+  const std::string trace = buffer.str();
+
+  EXPECT_EQ(0u, trace.find("{\"traceEvents\":["));
+  EXPECT_NE(std::string::npos, trace.find("{\"name\":\"CastImageFilter\",\"cat\":\"Execute\",\"ph\":\"X\""));
+  EXPECT_NE(std::string::npos, trace.find("{\"name\":\"Update\",\"cat\":\"ITK\""));
+  EXPECT_NE(std::string::npos, trace.find("{\"name\":\"OutputConversion\""));
+  EXPECT_NE(std::string::npos, trace.find("\"Scope \\\"quoted\\\"\""));
+
+  // only the traced execution is recorded
+  EXPECT_EQ(trace.find("\"cat\":\"Execute\""), trace.rfind("\"cat\":\"Execute\""));
+
+  sitk::ClearExecutionTrace();
+  sitk::WriteExecutionTrace(fileName);
+  std::ifstream cleared(fileName.c_str());
+  buffer.str("");
+  buffer << cleared.rdbuf();
+  EXPECT_EQ(std::string::npos, buffer.str().find("\"name\""));
+}
+
 TEST(Command, Test2)
 {
   // Check basic name functionality
@@ -911,6 +1014,8 @@ TEST(PixelID, TypeListHasPixelIDValue)
 {
   namespace sitk = itk::simple;
 
+  SITK_SKIP_IF_NOT_INSTANTIATED(sitk::sitkInt16, sitk::sitkLabelUInt16, sitk::sitkVectorInt16);
+
   EXPECT_FALSE(sitk::TypeListHasPixelIDValue(sitk::sitkUnknown));
   for (auto id : { sitk::sitkUInt8,
                    sitk::sitkFloat32,
@@ -927,3 +1032,251 @@ TEST(PixelID, TypeListHasPixelIDValue)
     EXPECT_FALSE(sitk::TypeListHasPixelIDValue<sitk::IntegerPixelIDTypeList>(id));
   };
 }
+
+
+namespace
+{
+class DispatchTestObject
+{
+public:
+  using MemberFunctionType = int64_t (DispatchTestObject::*)(int64_t);
+
+  template <class TImageType>
+  int64_t
+  ExecuteInternal(int64_t value)
+  {
+    return value + 1000 * TImageType::ImageDimension + itk::simple::ImageTypeToPixelIDValue<TImageType>::Result;
+  }
+};
+} // namespace
+
+TEST(MemberFunctionFactory, Dispatch)
+{
+  namespace sitk = itk::simple;
+  using MemberFunctionType = DispatchTestObject::MemberFunctionType;
+
+  sitk::detail::MemberFunctionFactory<MemberFunctionType> factory;
+  factory.RegisterMemberFunctions<sitk::BasicPixelIDTypeList, 2, SITK_MAX_DIMENSION>();
+
+  EXPECT_TRUE(factory.HasMemberFunction(sitk::sitkFloat32, 3));
+  EXPECT_TRUE(factory.HasMemberFunction(sitk::sitkUInt8, SITK_MAX_DIMENSION));
+  EXPECT_FALSE(factory.HasMemberFunction(sitk::sitkVectorFloat32, 3));
+  EXPECT_FALSE(factory.HasMemberFunction(sitk::sitkFloat32, 1));
+  EXPECT_FALSE(factory.HasMemberFunction(sitk::sitkFloat32, SITK_MAX_DIMENSION + 1));
+  EXPECT_FALSE(factory.HasMemberFunction(sitk::sitkUnknown, 2));
+
+  DispatchTestObject object;
+  EXPECT_EQ(3001 + sitk::sitkFloat32, factory.GetMemberFunction(sitk::sitkFloat32, 3, &object)(1));
+  EXPECT_EQ(2000 + sitk::sitkInt16, factory.GetMemberFunction(sitk::sitkInt16, 2, &object)(0));
+  EXPECT_THROW(factory.GetMemberFunction(sitk::sitkVectorFloat32, 3, &object), sitk::GenericException);
+  EXPECT_THROW(factory.GetMemberFunction(sitk::sitkFloat32, SITK_MAX_DIMENSION + 1, &object), sitk::GenericException);
+  EXPECT_THROW(factory.GetMemberFunction(sitk::sitkUnknown, 2, &object), sitk::GenericException);
+}
+
+// Measure the overhead of a dispatch, compared to the lookup in a hash
+// map and the binding of a std::function. The timings depend on the
+// machine and the build, so the test is disabled and is run manually
+// with --gtest_also_run_disabled_tests.
+TEST(MemberFunctionFactory, DISABLED_DispatchPerformance)
+{
+  namespace sitk = itk::simple;
+  using MemberFunctionType = DispatchTestObject::MemberFunctionType;
+
+  sitk::detail::MemberFunctionFactory<MemberFunctionType> factory;
+  factory.RegisterMemberFunctions<sitk::BasicPixelIDTypeList, 2, SITK_MAX_DIMENSION>();
+  DispatchTestObject object;
+
+  using KeyType = std::pair<unsigned int, int>;
+  std::unordered_map<KeyType, MemberFunctionType, sitk::detail::hash<KeyType>> hashMap;
+  hashMap[KeyType(3, sitk::sitkFloat32)] = &DispatchTestObject::ExecuteInternal<itk::Image<float, 3>>;
+
+  constexpr int64_t numberOfCalls = 1000000;
+  int64_t           sum = 0;
+
+  auto start = std::chrono::steady_clock::now();
+  for (int64_t i = 0; i < numberOfCalls; ++i)
+  {
+    MemberFunctionType              pfunc = hashMap.find(KeyType(3, sitk::sitkFloat32))->second;
+    std::function<int64_t(int64_t)> f = [pfunc, &object](int64_t value) { return (object.*pfunc)(value); };
+    sum += f(i);
+  }
+  const std::chrono::duration<double, std::nano> hashMapTime = std::chrono::steady_clock::now() - start;
+
+  start = std::chrono::steady_clock::now();
+  for (int64_t i = 0; i < numberOfCalls; ++i)
+  {
+    sum -= factory.GetMemberFunction(sitk::sitkFloat32, 3, &object)(i);
+  }
+  const std::chrono::duration<double, std::nano> factoryTime = std::chrono::steady_clock::now() - start;
+
+  EXPECT_EQ(0, sum);
+  std::cout << "Dispatch overhead per call, hash map and std::function: " << hashMapTime.count() / numberOfCalls
+            << " ns, MemberFunctionFactory: " << factoryTime.count() / numberOfCalls << " ns" << std::endl;
+}
+
+TEST(PixelBufferAllocator, Pooled)
+{
+  namespace sitk = itk::simple;
+
+  sitk::PooledPixelBufferAllocator pool;
+  pool.SetMinimumPooledSize(8192);
+  EXPECT_EQ(8192u, pool.GetMinimumPooledSize());
+
+  // small buffers are not pooled
+  void * buffer = pool.Allocate(100);
+  EXPECT_EQ(0u, reinterpret_cast<uintptr_t>(buffer) % sitk::PooledPixelBufferAllocator::Alignment);
+  pool.Deallocate(buffer, 100);
+  EXPECT_EQ(0u, pool.GetNumberOfHits());
+  EXPECT_EQ(0u, pool.GetNumberOfMisses());
+  EXPECT_EQ(0u, pool.GetBytesHeld());
+
+  buffer = pool.Allocate(10000);
+  EXPECT_EQ(0u, reinterpret_cast<uintptr_t>(buffer) % sitk::PooledPixelBufferAllocator::Alignment);
+  EXPECT_EQ(1u, pool.GetNumberOfMisses());
+  pool.Deallocate(buffer, 10000);
+  EXPECT_EQ(1u, pool.GetNumberOfBuffersHeld());
+  EXPECT_EQ(12288u, pool.GetBytesHeld());
+
+  // the same size class reuses the held buffer
+  void * buffer2 = pool.Allocate(12000);
+  EXPECT_EQ(buffer, buffer2);
+  EXPECT_EQ(1u, pool.GetNumberOfHits());
+  EXPECT_EQ(0u, pool.GetBytesHeld());
+
+  void * buffer3 = pool.Allocate(20000);
+  EXPECT_EQ(2u, pool.GetNumberOfMisses());
+  pool.Deallocate(buffer2, 12000);
+  pool.Deallocate(buffer3, 20000);
+  EXPECT_EQ(2u, pool.GetNumberOfBuffersHeld());
+
+  // the largest buffers are released first
+  pool.SetMaximumBytesHeld(16384);
+  EXPECT_EQ(1u, pool.GetNumberOfBuffersHeld());
+  EXPECT_EQ(12288u, pool.GetBytesHeld());
+
+  pool.ReleaseHeldBuffers();
+  EXPECT_EQ(0u, pool.GetNumberOfBuffersHeld());
+  EXPECT_EQ(0u, pool.GetBytesHeld());
+}
+
+
+TEST(PixelBufferAllocator, Global)
+{
+  namespace sitk = itk::simple;
+
+  SITK_SKIP_IF_NOT_INSTANTIATED(sitk::sitkUInt16);
+
+  EXPECT_EQ(nullptr, sitk::Image::GetGlobalPixelBufferAllocator());
+
+  auto pool = std::make_shared<sitk::PooledPixelBufferAllocator>();
+  pool->SetMinimumPooledSize(4096);
+  sitk::Image::SetGlobalPixelBufferAllocator(pool);
+  EXPECT_EQ(pool, sitk::Image::GetGlobalPixelBufferAllocator());
+
+  {
+    sitk::Image image(64, 64, 16, sitk::sitkFloat32);
+    EXPECT_EQ(1u, pool->GetNumberOfMisses());
+    EXPECT_EQ(0u,
+              reinterpret_cast<uintptr_t>(image.GetBufferAsFloat()) % sitk::PooledPixelBufferAllocator::Alignment);
+    EXPECT_EQ(0.0f, image.GetPixelAsFloat({ 3, 4, 5 }));
+    image.SetPixelAsFloat({ 3, 4, 5 }, 5.0f);
+  }
+  EXPECT_EQ(1u, pool->GetNumberOfBuffersHeld());
+
+  {
+    // the released buffer is reused and initialized
+    sitk::Image image(64, 64, 16, sitk::sitkFloat32);
+    EXPECT_EQ(1u, pool->GetNumberOfHits());
+    EXPECT_EQ(0u, pool->GetNumberOfBuffersHeld());
+    EXPECT_EQ(0.0f, image.GetPixelAsFloat({ 3, 4, 5 }));
+
+    // the outputs of filters use the allocator
+    sitk::Image output = sitk::Cast(image, sitk::sitkUInt8);
+    EXPECT_LE(2u, pool->GetNumberOfMisses());
+  }
+  EXPECT_LE(2u, pool->GetNumberOfBuffersHeld());
+
+  // images outlive replacing the allocator
+  sitk::Image  image(64, 64, sitk::sitkUInt16);
+  const size_t numberOfBuffersHeld = pool->GetNumberOfBuffersHeld();
+  sitk::Image::SetGlobalPixelBufferAllocator(nullptr);
+  EXPECT_EQ(nullptr, sitk::Image::GetGlobalPixelBufferAllocator());
+  image = sitk::Image(64, 64, sitk::sitkUInt16);
+  EXPECT_EQ(numberOfBuffersHeld + 1, pool->GetNumberOfBuffersHeld());
+}
+
+
+TEST(BinaryMask, Conversion)
+{
+  namespace sitk = itk::simple;
+
+  // the number of pixels is not a multiple of the word size
+  sitk::Image image(13, 7, sitk::sitkUInt8);
+  image.SetOrigin({ 1.0, 2.0 });
+  image.SetSpacing({ 0.5, 0.25 });
+  image.SetPixelAsUInt8({ 0, 0 }, 1);
+  image.SetPixelAsUInt8({ 12, 4 }, 255);
+  image.SetPixelAsUInt8({ 12, 6 }, 3);
+
+  sitk::BinaryMask mask(image);
+  EXPECT_EQ(2u, mask.GetDimension());
+  EXPECT_EQ(image.GetSize(), mask.GetSize());
+  EXPECT_EQ(image.GetOrigin(), mask.GetOrigin());
+  EXPECT_EQ(image.GetSpacing(), mask.GetSpacing());
+  EXPECT_EQ(image.GetDirection(), mask.GetDirection());
+  EXPECT_EQ(16u, mask.GetNumberOfBytes());
+  EXPECT_EQ(3u, mask.CountOn());
+  EXPECT_TRUE(mask.GetPixel({ 12, 4 }));
+  EXPECT_FALSE(mask.GetPixel({ 11, 4 }));
+  EXPECT_THROW(mask.GetPixel({ 13, 0 }), sitk::GenericException);
+
+  sitk::Image result = mask.ToImage();
+  EXPECT_EQ(sitk::sitkUInt8, result.GetPixelID());
+  EXPECT_EQ(image.GetOrigin(), result.GetOrigin());
+  EXPECT_EQ(image.GetSpacing(), result.GetSpacing());
+  EXPECT_EQ(1u, result.GetPixelAsUInt8({ 12, 4 }));
+  EXPECT_EQ(1u, result.GetPixelAsUInt8({ 12, 6 }));
+  EXPECT_EQ(0u, result.GetPixelAsUInt8({ 11, 6 }));
+  EXPECT_EQ(sitk::BinaryMask(result).GetWords(), mask.GetWords());
+
+  sitk::Image int16Image(5, 5, 5, sitk::sitkInt16);
+  int16Image.SetPixelAsInt16({ 1, 2, 3 }, -1);
+  EXPECT_EQ(1u, sitk::BinaryMask(int16Image).CountOn());
+
+  EXPECT_THROW(sitk::BinaryMask(sitk::Image(5, 5, sitk::sitkFloat32)), sitk::GenericException);
+  EXPECT_THROW(sitk::BinaryMask(std::vector<unsigned int>{ 5 }), sitk::GenericException);
+}
+
+
+TEST(BinaryMask, LogicalOperations)
+{
+  namespace sitk = itk::simple;
+
+  sitk::BinaryMask a({ 10, 10, 3 });
+  EXPECT_EQ(0u, a.CountOn());
+  EXPECT_EQ(std::vector<double>({ 1, 0, 0, 0, 1, 0, 0, 0, 1 }), a.GetDirection());
+
+  sitk::BinaryMask b(a);
+  a.SetPixel({ 1, 1, 1 }, true);
+  a.SetPixel({ 2, 2, 2 }, true);
+  b.SetPixel({ 2, 2, 2 }, true);
+  b.SetPixel({ 9, 9, 2 }, true);
+
+  EXPECT_EQ(1u, (a & b).CountOn());
+  EXPECT_EQ(3u, (a | b).CountOn());
+  EXPECT_EQ(2u, (a ^ b).CountOn());
+  EXPECT_TRUE((a ^ b).GetPixel({ 9, 9, 2 }));
+
+  // bits past the last pixel are not set
+  EXPECT_EQ(298u, (~a).CountOn());
+  a.Fill(true);
+  EXPECT_EQ(300u, a.CountOn());
+  a.Not();
+  EXPECT_EQ(0u, a.CountOn());
+
+  a.SetPixel({ 0, 0, 0 }, true);
+  a.SetPixel({ 0, 0, 0 }, false);
+  EXPECT_EQ(0u, a.CountOn());
+
+  EXPECT_THROW(a.And(sitk::BinaryMask({ 10, 10 })), sitk::GenericException);
+}
@@ -188,6 +188,8 @@ TEST_F(Image4D, ImageDataType)
 
 TEST_F(Image4D, Constructors)
 {
+  SITK_SKIP_IF_NOT_INSTANTIATED(itk::simple::sitkUInt16, itk::simple::sitkLabelUInt16, itk::simple::sitkVectorUInt16);
+
   itk::simple::HashImageFilter hasher;
   hasher.SetHashFunction(itk::simple::HashImageFilter::SHA1);
 
@@ -397,6 +399,8 @@ namespace sitk = itk::simple;
 
 TEST_F(Image4D, CopyInformation)
 {
+  SITK_SKIP_IF_NOT_INSTANTIATED(sitk::sitkUInt16);
+
   std::vector<unsigned int> s4d(4, 10);
   sitk::Image               img1d(10, 20, sitk::sitkFloat32);
   sitk::Image               img4d(s4d, sitk::sitkUInt32);
@@ -28,9 +28,13 @@
 
 #include <itksys/SystemTools.hxx>
 
+#include <chrono>
+#include <filesystem>
+
 
 TEST(IO, ImageFileReader)
 {
+  SITK_SKIP_IF_NOT_INSTANTIATED(itk::simple::sitkInt16, itk::simple::sitkInt32, itk::simple::sitkVectorInt32);
 
   namespace sitk = itk::simple;
 
@@ -157,6 +161,8 @@ TEST(IO, ImageFileWriter)
 {
   namespace sitk = itk::simple;
 
+  SITK_SKIP_IF_NOT_INSTANTIATED(sitk::sitkUInt16);
+
   sitk::ImageFileWriter writer;
 
   sitk::Image img = sitk::Image(10, 10, sitk::sitkUInt16);
@@ -258,6 +264,8 @@ TEST(IO, ImageFileWriter_Compression)
 TEST(IO, ReadWrite)
 {
   namespace sitk = itk::simple;
+  SITK_SKIP_IF_NOT_INSTANTIATED(sitk::sitkInt16);
+
   sitk::HashImageFilter hasher;
   sitk::ImageFileReader reader;
   sitk::ImageFileWriter writer;
@@ -639,6 +647,279 @@ TEST(IO, ImageSeriesReader_Spacing)
 }
 
 
+TEST(IO, ImageSeriesReader_NumberOfReadThreads)
+{
+  sitk::ImageSeriesReader reader;
+  EXPECT_EQ(1u, reader.GetNumberOfReadThreads());
+
+  std::vector<sitk::PathType> fileNames;
+  fileNames.push_back(dataFinder.GetFile("Input/BlackDots.png"));
+  fileNames.push_back(dataFinder.GetFile("Input/BlackDots.png"));
+  fileNames.push_back(dataFinder.GetFile("Input/BlackDots.png"));
+  fileNames.push_back(dataFinder.GetFile("Input/WhiteDots.png"));
+
+  reader.SetFileNames(fileNames);
+  reader.SetNumberOfReadThreads(4);
+  EXPECT_EQ(4u, reader.GetNumberOfReadThreads());
+  EXPECT_NO_THROW(reader.ToString());
+
+  CountCommand startCmd(reader);
+  reader.AddCommand(sitk::sitkStartEvent, startCmd);
+
+  CountCommand endCmd(reader);
+  reader.AddCommand(sitk::sitkEndEvent, endCmd);
+
+  sitk::Image image = reader.Execute();
+  EXPECT_EQ("62fff5903956f108fbafd506e31c1e733e527820", sitk::Hash(image));
+  EXPECT_EQ(4u, image.GetDepth());
+  EXPECT_EQ(1, startCmd.m_Count);
+  EXPECT_EQ(1, endCmd.m_Count);
+
+  // the slices are in the order of the file names
+  reader.ReverseOrderOn();
+  sitk::Image reversed = reader.Execute();
+  reader.SetNumberOfReadThreads(1);
+  EXPECT_EQ(sitk::Hash(reader.Execute()), sitk::Hash(reversed));
+  reader.ReverseOrderOff();
+
+  // the pixels are converted to the output pixel type
+  fileNames.resize(0);
+  fileNames.push_back(dataFinder.GetFile("Input/VM1111Shrink-RGB.png"));
+  fileNames.push_back(dataFinder.GetFile("Input/VM1111Shrink-RGB.png"));
+  fileNames.push_back(dataFinder.GetFile("Input/VM1111Shrink-RGB.png"));
+  reader.SetFileNames(fileNames);
+  reader.SetNumberOfReadThreads(0);
+  image = reader.Execute();
+  EXPECT_EQ("bb42b8d3991132b4860adbc4b3f6c38313f52b4c", sitk::Hash(image));
+  reader.SetOutputPixelType(sitk::sitkUInt8);
+  image = reader.Execute();
+  EXPECT_EQ("a51361940fdf6c33cf700e1002e5f5ca5b88cc42", sitk::Hash(image));
+  reader.SetOutputPixelType(sitk::sitkUnknown);
+
+  // the meta-data dictionary array is in the order of the slices
+  const std::string dicomDir = dataFinder.GetDirectory() + "/Input/DicomSeries";
+  reader.SetFileNames(sitk::ImageSeriesReader::GetGDCMSeriesFileNames(dicomDir));
+  reader.MetaDataDictionaryArrayUpdateOn();
+  reader.SetNumberOfReadThreads(1);
+  sitk::Image sequential = reader.Execute();
+  std::vector<std::string> sequentialInstances;
+  for (unsigned int i = 0; i < sequential.GetSize()[2]; ++i)
+  {
+    sequentialInstances.push_back(reader.GetMetaData(i, "0020|0013"));
+  }
+
+  reader.SetNumberOfReadThreads(3);
+  image = reader.Execute();
+  EXPECT_EQ("f5ad2854d68fc87a141e112e529d47424b58acfb", sitk::Hash(image));
+  EXPECT_EQ(sequential.GetOrigin(), image.GetOrigin());
+  EXPECT_EQ(sequential.GetSpacing(), image.GetSpacing());
+  EXPECT_EQ(sequential.GetDirection(), image.GetDirection());
+  for (unsigned int i = 0; i < image.GetSize()[2]; ++i)
+  {
+    EXPECT_EQ(95u, reader.GetMetaDataKeys(i).size());
+    EXPECT_EQ(sequentialInstances[i], reader.GetMetaData(i, "0020|0013"));
+  }
+  EXPECT_FALSE(reader.HasMetaDataKey(0, "nothing"));
+  EXPECT_ANY_THROW(reader.GetMetaDataKeys(99));
+  EXPECT_ANY_THROW(reader.HasMetaDataKey(99, "nothing"));
+  EXPECT_ANY_THROW(reader.GetMetaData(99, "nothing"));
+}
+
+
+TEST(IO, ImageSeriesReader_NumberOfReadThreads_Timeout)
+{
+  std::vector<sitk::PathType> fileNames(8, dataFinder.GetFile("Input/BlackDots.png"));
+
+  sitk::ImageSeriesReader reader;
+  reader.SetFileNames(fileNames);
+  reader.SetNumberOfReadThreads(4);
+  const std::string expectedHash = sitk::Hash(reader.Execute());
+
+  CountCommand endCmd(reader);
+  reader.AddCommand(sitk::sitkEndEvent, endCmd);
+
+  CountCommand abortCmd(reader);
+  reader.AddCommand(sitk::sitkAbortEvent, abortCmd);
+
+  reader.SetExecutionTimeout(1e-9);
+  try
+  {
+    reader.Execute();
+    FAIL() << "Expected a TimeoutException";
+  }
+  catch (sitk::TimeoutException & e)
+  {
+    EXPECT_LT(1e-9, e.GetElapsedTime());
+  }
+  EXPECT_EQ(1, endCmd.m_Count);
+  EXPECT_EQ(1, abortCmd.m_Count);
+
+  // a slice which fails to be read still ends the execution
+  reader.SetExecutionTimeout(0.0);
+  fileNames[3] = "does_not_exist.png";
+  reader.SetFileNames(fileNames);
+  EXPECT_ANY_THROW(reader.Execute());
+  EXPECT_EQ(2, endCmd.m_Count);
+  EXPECT_EQ(1, abortCmd.m_Count);
+
+  fileNames[3] = fileNames.front();
+  reader.SetFileNames(fileNames);
+  EXPECT_EQ(expectedHash, sitk::Hash(reader.Execute()));
+  EXPECT_EQ(3, endCmd.m_Count);
+}
+
+
+TEST(IO, ImageSeriesReader_Extract)
+{
+  std::vector<sitk::PathType> fileNames;
+  fileNames.push_back(dataFinder.GetFile("Input/BlackDots.png"));
+  fileNames.push_back(dataFinder.GetFile("Input/BlackDots.png"));
+  fileNames.push_back(dataFinder.GetFile("Input/BlackDots.png"));
+  fileNames.push_back(dataFinder.GetFile("Input/WhiteDots.png"));
+
+  sitk::ImageSeriesReader reader;
+  reader.SetFileNames(fileNames);
+  EXPECT_TRUE(reader.GetExtractSize().empty());
+  EXPECT_TRUE(reader.GetExtractIndex().empty());
+
+  const sitk::Image full = reader.Execute();
+
+  // a slab of slices
+  reader.SetExtractSize({ 256, 256, 2 });
+  reader.SetExtractIndex({ 0, 0, 2 });
+  EXPECT_EQ(std::vector<unsigned int>({ 256, 256, 2 }), reader.GetExtractSize());
+  EXPECT_EQ(std::vector<int>({ 0, 0, 2 }), reader.GetExtractIndex());
+  EXPECT_NO_THROW(reader.ToString());
+
+  sitk::Image image = reader.Execute();
+  sitk::Image expected = sitk::Extract(full, { 256, 256, 2 }, { 0, 0, 2 });
+  EXPECT_EQ(sitk::Hash(expected), sitk::Hash(image));
+  EXPECT_EQ(expected.GetSize(), image.GetSize());
+  EXPECT_VECTOR_DOUBLE_NEAR(expected.GetOrigin(), image.GetOrigin(), 1e-8);
+
+  // an in-plane region of a single slice
+  reader.SetExtractSize({ 100, 50, 0 });
+  reader.SetExtractIndex({ 10, 20, 3 });
+  image = reader.Execute();
+  expected = sitk::Extract(full, { 100, 50, 0 }, { 10, 20, 3 });
+  EXPECT_EQ(2u, image.GetDimension());
+  EXPECT_EQ(sitk::Hash(expected), sitk::Hash(image));
+  EXPECT_VECTOR_DOUBLE_NEAR(expected.GetOrigin(), image.GetOrigin(), 1e-8);
+
+  // missing sizes are zero
+  reader.SetExtractSize({ 100, 50 });
+  image = reader.Execute();
+  EXPECT_EQ(sitk::Hash(expected), sitk::Hash(image));
+
+  // the region is outside of the series
+  reader.SetExtractSize({ 256, 256, 2 });
+  reader.SetExtractIndex({ 0, 0, 3 });
+  EXPECT_THROW(reader.Execute(), sitk::GenericException);
+
+  reader.SetExtractSize({ 256, 256, 1, 1 });
+  reader.SetExtractIndex({});
+  EXPECT_THROW(reader.Execute(), sitk::GenericException);
+
+  reader.SetExtractSize({ 256, 0, 0 });
+  EXPECT_THROW(reader.Execute(), sitk::GenericException);
+
+  // the meta-data dictionary array is available with an extraction
+  const std::string dicomDir = dataFinder.GetDirectory() + "/Input/DicomSeries";
+  reader.SetFileNames(sitk::ImageSeriesReader::GetGDCMSeriesFileNames(dicomDir));
+  reader.SetExtractSize({});
+  reader.SetExtractIndex({});
+  const sitk::Image dicom = reader.Execute();
+
+  reader.MetaDataDictionaryArrayUpdateOn();
+  reader.SetExtractSize({ dicom.GetWidth(), dicom.GetHeight(), 1 });
+  reader.SetExtractIndex({ 0, 0, 1 });
+  image = reader.Execute();
+  expected = sitk::Extract(dicom, { dicom.GetWidth(), dicom.GetHeight(), 1 }, { 0, 0, 1 });
+  EXPECT_EQ(sitk::Hash(expected), sitk::Hash(image));
+  EXPECT_TRUE(reader.HasMetaDataKey(1, "0020|0013"));
+}
+
+TEST(IO, ImageSeriesReader_ScanDICOMDirectory)
+{
+  const std::string dicomDir = dataFinder.GetDirectory() + "/Input/DicomSeries";
+  const std::string seriesID = "1.2.840.113619.2.133.1762890640.1886.1055165015.999";
+
+  auto series = sitk::ImageSeriesReader::ScanDICOMDirectory(dicomDir, { "0008|0060", "0020|0013" });
+
+  std::vector<std::string> seriesIDs = sitk::ImageSeriesReader::GetGDCMSeriesIDs(dicomDir);
+  ASSERT_EQ(seriesIDs.size(), series.size());
+  for (const auto & id : seriesIDs)
+  {
+    ASSERT_EQ(1u, series.count(id)) << "Missing series " << id;
+    EXPECT_EQ(sitk::ImageSeriesReader::GetGDCMSeriesFileNames(dicomDir, id), series[id].FileNames);
+    EXPECT_EQ(series[id].FileNames.size(), series[id].MetaData.size());
+  }
+
+  const auto & dicomSeries = series[seriesID];
+  ASSERT_EQ(3u, dicomSeries.FileNames.size());
+  for (const auto & metaData : dicomSeries.MetaData)
+  {
+    EXPECT_EQ(2u, metaData.size());
+    EXPECT_EQ(1u, metaData.count("0008|0060"));
+    EXPECT_EQ(1u, metaData.count("0020|0013"));
+  }
+
+  EXPECT_THROW(sitk::ImageSeriesReader::ScanDICOMDirectory(dicomDir, { "0008,0060" }), sitk::GenericException);
+  EXPECT_TRUE(sitk::ImageSeriesReader::ScanDICOMDirectory(dataFinder.GetDirectory() + "/Input/DoesNotExist").empty());
+}
+
+
+TEST(IO, ImageSeriesReader_NumberOfReadThreads_Spacing)
+{
+  const sitk::PathType seriesDir = dataFinder.GetOutputDirectory() + "/SeriesSpacingThreads";
+
+  if (itksys::SystemTools::FileExists(seriesDir))
+  {
+    itksys::SystemTools::RemoveADirectory(seriesDir);
+  }
+  itksys::SystemTools::MakeDirectory(seriesDir);
+
+  const std::vector<sitk::PathType> seriesPaths{ seriesDir + "/000000.mha",
+                                                 seriesDir + "/000001.mha",
+                                                 seriesDir + "/000002.mha" };
+  auto                              image = sitk::Image(10, 10, (unsigned int)seriesPaths.size(), sitk::sitkUInt8);
+  image.SetSpacing({ 2.0, 3.0, 1.12999 });
+
+  for (size_t i = 0; i < seriesPaths.size(); ++i)
+  {
+    auto slice = sitk::Extract(image, { image.GetSize()[0], image.GetSize()[1], 1 }, { 0, 0, static_cast<int>(i) });
+    auto origin = slice.GetOrigin();
+    if (i == image.GetSize()[2] - 1)
+    {
+      origin[2] += 1e-5;
+      slice.SetOrigin(origin);
+    }
+
+    sitk::WriteImage(slice, seriesPaths[i]);
+  };
+
+  sitk::ImageSeriesReader reader;
+  reader.SetFileNames(seriesPaths);
+  reader.SetNumberOfReadThreads(3);
+
+  MockLogger logger;
+  logger.SetAsGlobalITKLogger();
+
+  reader.Execute();
+
+  EXPECT_EQ(logger.m_DisplayWarningText.str().length(), 0u)
+    << "Checking warnings: " << logger.m_DisplayWarningText.str();
+
+  logger.Clear();
+
+  reader.SetSpacingWarningRelThreshold(1e-24);
+  reader.Execute();
+
+  EXPECT_NE(logger.m_DisplayWarningText.str().find("nonuniformity"), std::string::npos)
+    << "Checking expected warning in " << logger.m_DisplayWarningText.str();
+}
+
+
 TEST(IO, ImageSeriesWriter)
 {
 
@@ -739,6 +1020,95 @@ TEST(IO, VectorImageSeriesWriter)
   EXPECT_EQ("1729319806705e94181c9b9f4bd5e0ac854935db", sitk::Hash(result));
 }
 
+
+TEST(IO, ImageSeriesWriter_NumberOfWriteThreads)
+{
+  std::vector<sitk::PathType> fileNames;
+  for (unsigned int i = 0; i < 5; ++i)
+  {
+    fileNames.push_back(dataFinder.GetOutputDirectory() + "/ImageSeriesWriter_Threads_" + std::to_string(i) + ".mha");
+  }
+
+  sitk::Image image = sitk::PhysicalPointSource(
+    sitk::sitkVectorFloat32, { 10, 11, 5 }, { 1.0, 2.0, 3.0 }, { 0.5, 0.6, 0.7 }, { 0, -1, 0, 1, 0, 0, 0, 0, 1 });
+
+  sitk::ImageSeriesWriter writer;
+  EXPECT_EQ(1u, writer.GetNumberOfWriteThreads());
+  writer.SetNumberOfWriteThreads(4);
+  EXPECT_EQ(4u, writer.GetNumberOfWriteThreads());
+  EXPECT_NO_THROW(writer.ToString());
+
+  CountCommand startCmd(writer);
+  writer.AddCommand(sitk::sitkStartEvent, startCmd);
+
+  CountCommand endCmd(writer);
+  writer.AddCommand(sitk::sitkEndEvent, endCmd);
+
+  writer.SetFileNames(fileNames);
+  writer.UseCompressionOn();
+  writer.SetCompressionLevel(9);
+  EXPECT_NO_THROW(writer.Execute(image));
+  EXPECT_EQ(1, startCmd.m_Count);
+  EXPECT_EQ(1, endCmd.m_Count);
+
+  for (unsigned int i = 0; i < fileNames.size(); ++i)
+  {
+    sitk::Image expected = sitk::Extract(image, { 10, 11, 0 }, { 0, 0, static_cast<int>(i) });
+    sitk::Image slice = sitk::ReadImage(fileNames[i]);
+    EXPECT_EQ(sitk::Hash(expected), sitk::Hash(slice)) << "slice " << i;
+    EXPECT_VECTOR_DOUBLE_NEAR(expected.GetOrigin(), slice.GetOrigin(), 1e-6);
+    EXPECT_VECTOR_DOUBLE_NEAR(expected.GetSpacing(), slice.GetSpacing(), 1e-6);
+    EXPECT_VECTOR_DOUBLE_NEAR(expected.GetDirection(), slice.GetDirection(), 1e-6);
+  }
+
+  fileNames.pop_back();
+  writer.SetFileNames(fileNames);
+  EXPECT_ANY_THROW(writer.Execute(image));
+}
+
+
+TEST(IO, ImageSeriesWriter_NumberOfWriteThreads_Timeout)
+{
+  std::vector<sitk::PathType> fileNames;
+  for (unsigned int i = 0; i < 8; ++i)
+  {
+    fileNames.push_back(dataFinder.GetOutputDirectory() + "/ImageSeriesWriter_Timeout_" + std::to_string(i) + ".mha");
+  }
+
+  sitk::Image image = sitk::PhysicalPointSource(sitk::sitkVectorFloat32, { 10, 11, 8 });
+
+  sitk::ImageSeriesWriter writer;
+  writer.SetFileNames(fileNames);
+  writer.SetNumberOfWriteThreads(4);
+
+  CountCommand endCmd(writer);
+  writer.AddCommand(sitk::sitkEndEvent, endCmd);
+
+  CountCommand abortCmd(writer);
+  writer.AddCommand(sitk::sitkAbortEvent, abortCmd);
+
+  writer.SetExecutionTimeout(1e-9);
+  try
+  {
+    writer.Execute(image);
+    FAIL() << "Expected a TimeoutException";
+  }
+  catch (sitk::TimeoutException & e)
+  {
+    EXPECT_LT(1e-9, e.GetElapsedTime());
+  }
+  EXPECT_EQ(1, endCmd.m_Count);
+  EXPECT_EQ(1, abortCmd.m_Count);
+
+  // a slice which fails to be written still ends the execution
+  writer.SetExecutionTimeout(0.0);
+  fileNames[3] = dataFinder.GetOutputDirectory() + "/does_not_exist/ImageSeriesWriter_Timeout.mha";
+  writer.SetFileNames(fileNames);
+  EXPECT_ANY_THROW(writer.Execute(image));
+  EXPECT_EQ(2, endCmd.m_Count);
+  EXPECT_EQ(1, abortCmd.m_Count);
+}
+
 TEST(IO, ImageFileReader_ImageInformation)
 {
   const std::string dicomFile1 = dataFinder.GetDirectory() + "/Input/DicomSeries/Image0075.dcm";
@@ -923,6 +1293,163 @@ TEST(IO, ImageFileReader_Extract1)
 }
 
 
+TEST(IO, ImageFileReader_MemoryMapping)
+{
+  sitk::ImageFileReader reader;
+  EXPECT_FALSE(reader.GetUseMemoryMapping());
+  reader.UseMemoryMappingOn();
+  EXPECT_TRUE(reader.GetUseMemoryMapping());
+
+  CountCommand startCmd(reader);
+  reader.AddCommand(sitk::sitkStartEvent, startCmd);
+
+  CountCommand endCmd(reader);
+  reader.AddCommand(sitk::sitkEndEvent, endCmd);
+
+  sitk::Image source({ 32, 24, 16 }, sitk::sitkFloat32);
+  source = sitk::AdditiveGaussianNoise(source, 10.0, 0.0, 99u);
+  source.SetOrigin({ 1.0, 2.0, 3.0 });
+  source.SetSpacing({ 0.5, 0.75, 1.25 });
+  const std::string expectedHash = sitk::Hash(source);
+
+  const std::vector<std::string> extensions = { ".mha", ".mhd", ".nrrd", ".nhdr" };
+
+  for (const auto & ext : extensions)
+  {
+    const std::string filename = dataFinder.GetOutputFile("ImageFileReader_MemoryMapping" + ext);
+    sitk::WriteImage(source, filename, false);
+
+    reader.SetFileName(filename);
+    sitk::Image image = reader.Execute();
+
+    EXPECT_EQ(expectedHash, sitk::Hash(image)) << "filename : " << filename;
+    EXPECT_EQ(source.GetOrigin(), image.GetOrigin()) << "filename : " << filename;
+    EXPECT_EQ(1, startCmd.m_Count) << "filename : " << filename;
+    EXPECT_EQ(1, endCmd.m_Count) << "filename : " << filename;
+    startCmd.m_Count = endCmd.m_Count = 0;
+    EXPECT_EQ(source.GetSpacing(), image.GetSpacing()) << "filename : " << filename;
+
+    // modifications of the mapped image must not change the file
+    sitk::Image copy = image;
+    image.SetPixelAsFloat({ 0, 0, 0 }, 1234.0f);
+    image.GetBufferAsFloat()[1] = 4321.0f;
+    EXPECT_EQ(expectedHash, sitk::Hash(copy)) << "filename : " << filename;
+    EXPECT_EQ(expectedHash, sitk::Hash(sitk::ReadImage(filename))) << "filename : " << filename;
+  }
+
+  // files which can not be mapped are read normally
+  const std::string compressedFilename = dataFinder.GetOutputFile("ImageFileReader_MemoryMapping_Compressed.mha");
+  sitk::WriteImage(source, compressedFilename, true);
+  reader.SetFileName(compressedFilename);
+  EXPECT_EQ(expectedHash, sitk::Hash(reader.Execute()));
+
+  reader.SetFileName(dataFinder.GetOutputFile("ImageFileReader_MemoryMapping.mha"));
+  reader.SetOutputPixelType(sitk::sitkFloat64);
+  EXPECT_EQ(sitk::sitkFloat64, reader.Execute().GetPixelID());
+  reader.SetOutputPixelType(sitk::sitkUnknown);
+
+  reader.SetExtractSize({ 4, 4, 0 });
+  EXPECT_EQ(std::vector<unsigned int>({ 4, 4 }), reader.Execute().GetSize());
+}
+
+TEST(IO, ImageFileReader_HeaderCache)
+{
+  const std::string cacheFilename = dataFinder.GetOutputFile("ImageFileReader_HeaderCache.cache");
+  const std::string filename = dataFinder.GetOutputFile("ImageFileReader_HeaderCache.nrrd");
+  itksys::SystemTools::RemoveFile(cacheFilename);
+
+  sitk::Image source({ 32, 24, 16 }, sitk::sitkInt16);
+  source.SetOrigin({ 1.0, 2.0, 3.0 });
+  source.SetSpacing({ 0.1, 0.75, 1.0 / 3.0 });
+  source.SetMetaData("Description", "a description: with a colon");
+  sitk::WriteImage(source, filename);
+
+  sitk::ImageFileReader expected;
+  expected.SetFileName(filename);
+  expected.ReadImageInformation();
+
+  {
+    sitk::ImageFileReader reader;
+    EXPECT_EQ("", reader.GetHeaderCacheFileName());
+    reader.SetHeaderCacheFileName(cacheFilename);
+    EXPECT_EQ(cacheFilename, reader.GetHeaderCacheFileName());
+    reader.SetFileName(filename);
+    reader.ReadImageInformation();
+    EXPECT_EQ(expected.GetSize(), reader.GetSize());
+  }
+  // the cache is written when the reader is destroyed
+  ASSERT_TRUE(itksys::SystemTools::FileExists(cacheFilename));
+
+  sitk::ImageFileReader reader;
+  reader.SetHeaderCacheFileName(cacheFilename);
+  reader.SetFileName(filename);
+  reader.ReadImageInformation();
+
+  EXPECT_EQ(expected.GetPixelID(), reader.GetPixelID());
+  EXPECT_EQ(expected.GetDimension(), reader.GetDimension());
+  EXPECT_EQ(expected.GetNumberOfComponents(), reader.GetNumberOfComponents());
+  EXPECT_EQ(expected.GetOrigin(), reader.GetOrigin());
+  EXPECT_EQ(expected.GetSpacing(), reader.GetSpacing());
+  EXPECT_EQ(expected.GetDirection(), reader.GetDirection());
+  EXPECT_EQ(expected.GetSize(), reader.GetSize());
+  EXPECT_EQ(expected.GetMetaDataKeys(), reader.GetMetaDataKeys());
+  for (const auto & key : expected.GetMetaDataKeys())
+  {
+    EXPECT_EQ(expected.GetMetaData(key), reader.GetMetaData(key)) << "key: " << key;
+  }
+
+  // a modified file is read again
+  sitk::WriteImage(sitk::Image({ 10, 11 }, sitk::sitkFloat32), filename);
+  reader.ReadImageInformation();
+  EXPECT_EQ(sitk::sitkFloat32, reader.GetPixelID());
+  EXPECT_EQ(std::vector<uint64_t>({ 10, 11 }), reader.GetSize());
+
+  // a file rewritten with the same size is read again. The modification
+  // time of the cached file is set in the past, so the rewrite changes
+  // it with any resolution of the file system's time stamps.
+  std::filesystem::last_write_time(filename,
+                                   std::filesystem::last_write_time(filename) - std::chrono::seconds(10));
+  reader.ReadImageInformation();
+  sitk::Image sameSize({ 10, 11 }, sitk::sitkFloat32);
+  sameSize.SetOrigin({ 2.0, 3.0 });
+  sitk::WriteImage(sameSize, filename);
+  reader.ReadImageInformation();
+  EXPECT_EQ(std::vector<double>({ 2.0, 3.0 }), reader.GetOrigin());
+
+  // the information cached for the ImageIO found is not used for a forced ImageIO
+  reader.SetImageIO("PNGImageIO");
+  EXPECT_ANY_THROW(reader.ReadImageInformation());
+}
+
+TEST(IO, ImageSeriesReader_ScanDICOMDirectoryHeaderCache)
+{
+  const std::string dicomDir = dataFinder.GetDirectory() + "/Input/DicomSeries";
+  const std::string cacheFilename = dataFinder.GetOutputFile("ImageSeriesReader_ScanDICOMDirectory.cache");
+  itksys::SystemTools::RemoveFile(cacheFilename);
+
+  auto expected = sitk::ImageSeriesReader::ScanDICOMDirectory(dicomDir, { "0008|0060", "0020|0013" });
+
+  auto series = sitk::ImageSeriesReader::ScanDICOMDirectory(dicomDir, { "0008|0060" }, false, cacheFilename);
+  ASSERT_TRUE(itksys::SystemTools::FileExists(cacheFilename));
+
+  // the cached headers do not contain the added tag
+  series = sitk::ImageSeriesReader::ScanDICOMDirectory(dicomDir, { "0008|0060", "0020|0013" }, false, cacheFilename);
+  ASSERT_EQ(expected.size(), series.size());
+  for (const auto & s : expected)
+  {
+    EXPECT_EQ(s.second.FileNames, series[s.first].FileNames);
+    EXPECT_EQ(s.second.MetaData, series[s.first].MetaData);
+  }
+
+  series = sitk::ImageSeriesReader::ScanDICOMDirectory(dicomDir, { "0008|0060", "0020|0013" }, false, cacheFilename);
+  ASSERT_EQ(expected.size(), series.size());
+  for (const auto & s : expected)
+  {
+    EXPECT_EQ(s.second.FileNames, series[s.first].FileNames);
+    EXPECT_EQ(s.second.MetaData, series[s.first].MetaData);
+  }
+}
+
 TEST(IO, ImageFileReader_Extract2)
 {
 
@@ -20,6 +20,7 @@
 #include <sitkImageFileReader.h>
 #include <sitkImageFileWriter.h>
 #include <sitkHashImageFilter.h>
+#include <sitkImageMemoryStatistics.h>
 
 #include "sitkAddImageFilter.h"
 #include "sitkSubtractImageFilter.h"
@@ -126,20 +127,42 @@ public:
   std::vector<double> directionI3D{ 1.0, 0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 1.0 };
 
 
-  const std::list<sitk::PixelIDValueEnum> labelTypes = { sitk::sitkLabelUInt8,
-                                                         sitk::sitkLabelUInt16,
-                                                         sitk::sitkLabelUInt32,
-                                                         sitk::sitkLabelUInt64 };
-  const std::list<sitk::PixelIDValueEnum> basicTypes = { sitk::sitkUInt8,  sitk::sitkUInt16, sitk::sitkUInt32,
-                                                         sitk::sitkUInt64, sitk::sitkInt8,   sitk::sitkInt16,
-                                                         sitk::sitkInt32,  sitk::sitkInt64,  sitk::sitkFloat32,
-                                                         sitk::sitkFloat64 };
+  // The pixel ids which are not instantiated are sitkUnknown, and are
+  // removed from the lists.
+  static std::list<sitk::PixelIDValueEnum>
+  InstantiatedPixelIDs(std::list<sitk::PixelIDValueEnum> pixelIDs)
+  {
+    pixelIDs.remove(sitk::sitkUnknown);
+    return pixelIDs;
+  }
+
+  const std::list<sitk::PixelIDValueEnum> labelTypes = InstantiatedPixelIDs({ sitk::sitkLabelUInt8,
+                                                                               sitk::sitkLabelUInt16,
+                                                                               sitk::sitkLabelUInt32,
+                                                                               sitk::sitkLabelUInt64 });
+  const std::list<sitk::PixelIDValueEnum> basicTypes =
+    InstantiatedPixelIDs({ sitk::sitkUInt8,
+                           sitk::sitkUInt16,
+                           sitk::sitkUInt32,
+                           sitk::sitkUInt64,
+                           sitk::sitkInt8,
+                           sitk::sitkInt16,
+                           sitk::sitkInt32,
+                           sitk::sitkInt64,
+                           sitk::sitkFloat32,
+                           sitk::sitkFloat64 });
   const std::list<sitk::PixelIDValueEnum> complexTypes = { sitk::sitkComplexFloat32, sitk::sitkComplexFloat64 };
-  const std::list<sitk::PixelIDValueEnum> vectorTypes = { sitk::sitkVectorUInt8,   sitk::sitkVectorUInt16,
-                                                          sitk::sitkVectorUInt32,  sitk::sitkVectorUInt64,
-                                                          sitk::sitkVectorInt8,    sitk::sitkVectorInt16,
-                                                          sitk::sitkVectorInt32,   sitk::sitkVectorInt64,
-                                                          sitk::sitkVectorFloat32, sitk::sitkVectorFloat64 };
+  const std::list<sitk::PixelIDValueEnum> vectorTypes =
+    InstantiatedPixelIDs({ sitk::sitkVectorUInt8,
+                           sitk::sitkVectorUInt16,
+                           sitk::sitkVectorUInt32,
+                           sitk::sitkVectorUInt64,
+                           sitk::sitkVectorInt8,
+                           sitk::sitkVectorInt16,
+                           sitk::sitkVectorInt32,
+                           sitk::sitkVectorInt64,
+                           sitk::sitkVectorFloat32,
+                           sitk::sitkVectorFloat64 });
 };
 
 
@@ -227,6 +250,8 @@ TEST_F(Image, ImageDataType)
 
 TEST_F(Image, Constructors)
 {
+  SITK_SKIP_IF_NOT_INSTANTIATED(sitk::sitkUInt16, sitk::sitkLabelUInt16, sitk::sitkVectorUInt16);
+
   sitk::HashImageFilter hasher;
   int                   result;
 
@@ -348,6 +373,76 @@ TEST_F(Image, Constructors)
   EXPECT_EQ(274560u, image.GetNumberOfPixels());
 }
 
+TEST_F(Image, CreateUninitialized)
+{
+  std::vector<unsigned int> s2d(2, 10);
+  std::vector<unsigned int> s3d(3, 5);
+
+  sitk::Image image = sitk::Image::CreateUninitialized(s3d, sitk::sitkInt16);
+  EXPECT_EQ(sitk::sitkInt16, image.GetPixelID());
+  EXPECT_EQ(s3d, image.GetSize());
+  EXPECT_EQ(1u, image.GetNumberOfComponentsPerPixel());
+  EXPECT_EQ(image.GetDirection(), directionI3D);
+  EXPECT_TRUE(image.IsUnique());
+
+  // the buffer is writable
+  std::fill(image.GetBufferAsInt16(), image.GetBufferAsInt16() + image.GetNumberOfPixels(), 7);
+  EXPECT_EQ(7, image.GetPixelAsInt16({ 4, 4, 4 }));
+
+  image = sitk::Image::CreateUninitialized(s2d, sitk::sitkVectorFloat32);
+  EXPECT_EQ(2u, image.GetNumberOfComponentsPerPixel());
+  image = sitk::Image::CreateUninitialized(s2d, sitk::sitkVectorFloat32, 5);
+  EXPECT_EQ(5u, image.GetNumberOfComponentsPerPixel());
+  EXPECT_EQ(s2d, image.GetSize());
+
+  image = sitk::Image::CreateUninitialized(s3d, sitk::sitkLabelUInt8);
+  EXPECT_EQ(sitk::sitkLabelUInt8, image.GetPixelID());
+  EXPECT_EQ(125u, image.GetNumberOfPixels());
+
+  // the same errors as the constructor
+  std::vector<unsigned int> s1d(1, 100);
+  EXPECT_ANY_THROW(sitk::Image::CreateUninitialized(s1d, sitk::sitkFloat32));
+  EXPECT_ANY_THROW(sitk::Image::CreateUninitialized(s2d, sitk::sitkUnknown));
+  EXPECT_ANY_THROW(sitk::Image::CreateUninitialized(s2d, sitk::sitkInt16, 10));
+}
+
+TEST_F(Image, MemoryStatistics)
+{
+  const sitk::ImageMemoryStatistics initial = sitk::GetImageMemoryStatistics();
+  EXPECT_LE(initial.LiveBytes, initial.PeakBytes);
+  EXPECT_LE(initial.NumberOfLiveBuffers, initial.NumberOfAllocations);
+
+  const uint64_t numberOfBytes = 32 * 32 * 8 * sizeof(float);
+  {
+    sitk::Image image({ 32, 32, 8 }, sitk::sitkFloat32);
+    sitk::Image copy = image;
+
+    sitk::ImageMemoryStatistics stats = sitk::GetImageMemoryStatistics();
+    EXPECT_EQ(initial.LiveBytes + numberOfBytes, stats.LiveBytes);
+    EXPECT_EQ(initial.NumberOfLiveBuffers + 1, stats.NumberOfLiveBuffers);
+    EXPECT_EQ(initial.NumberOfAllocations + 1, stats.NumberOfAllocations);
+    EXPECT_EQ(initial.LiveBytesPerPixelID[sitk::sitkFloat32] + numberOfBytes,
+              stats.LiveBytesPerPixelID[sitk::sitkFloat32]);
+
+    // copy on write allocates a second buffer
+    copy.SetPixelAsFloat({ 0, 0, 0 }, 1.0f);
+    stats = sitk::GetImageMemoryStatistics();
+    EXPECT_EQ(initial.LiveBytes + 2 * numberOfBytes, stats.LiveBytes);
+    EXPECT_LE(initial.LiveBytes + 2 * numberOfBytes, stats.PeakBytes);
+    EXPECT_EQ(initial.NumberOfAllocations + 2, stats.NumberOfAllocations);
+  }
+
+  sitk::ImageMemoryStatistics stats = sitk::GetImageMemoryStatistics();
+  EXPECT_EQ(initial.LiveBytes, stats.LiveBytes);
+  EXPECT_EQ(initial.NumberOfLiveBuffers, stats.NumberOfLiveBuffers);
+  EXPECT_EQ(initial.LiveBytesPerPixelID[sitk::sitkFloat32], stats.LiveBytesPerPixelID[sitk::sitkFloat32]);
+  EXPECT_LE(initial.LiveBytes + 2 * numberOfBytes, stats.PeakBytes);
+
+  sitk::ResetImageMemoryPeak();
+  stats = sitk::GetImageMemoryStatistics();
+  EXPECT_EQ(stats.LiveBytes, stats.PeakBytes);
+}
+
 TEST_F(Image, Hash)
 {
   sitk::HashImageFilter hasher;
@@ -464,6 +559,7 @@ TEST_F(Image, Properties)
 
 TEST_F(Image, CopyInformation)
 {
+  SITK_SKIP_IF_NOT_INSTANTIATED(sitk::sitkUInt16);
 
   sitk::Image img1(10, 20, sitk::sitkFloat32);
   sitk::Image img3d(10, 10, 10, sitk::sitkUInt32);
@@ -817,6 +913,8 @@ sitkClangDiagnosticPush();
 sitkClangWarningIgnore("-Wself-assign-overloaded");
 TEST_F(Image, Operators_InPlace)
 {
+  SITK_SKIP_IF_NOT_INSTANTIATED(sitk::sitkUInt16);
+
   sitk::Image img(10, 10, sitk::sitkUInt16);
 
   img += img;
@@ -848,6 +946,7 @@ sitkClangDiagnosticPop();
 
 TEST_F(Image, GetPixel)
 {
+  SITK_SKIP_IF_NOT_INSTANTIATED(sitk::sitkInt8, sitk::sitkUInt16, sitk::sitkInt32);
 
   // this test is designed to run all GetPixel methods for scalar types
 
@@ -1191,6 +1290,7 @@ TEST_F(Image, GetPixel)
 
 TEST_F(Image, GetPixelVector)
 {
+  SITK_SKIP_IF_NOT_INSTANTIATED(sitk::sitkVectorInt8, sitk::sitkVectorUInt16, sitk::sitkVectorInt32);
 
   std::vector<unsigned char> zero(2, 0);
 
@@ -1488,6 +1588,7 @@ TEST_F(Image, GetPixelVector)
 
 TEST_F(Image, GetBuffer)
 {
+  SITK_SKIP_IF_NOT_INSTANTIATED(sitk::sitkInt8, sitk::sitkUInt16, sitk::sitkInt32);
 
   // this test is designed to run all GetBuffer methods
   sitk::Image img = sitk::Image(10, 10, sitk::sitkUInt8);
@@ -1605,8 +1706,60 @@ TEST_F(Image, GetBuffer)
 }
 
 
+TEST_F(Image, GetSetPixels)
+{
+  sitk::Image img(10, 20, 30, sitk::sitkInt16);
+  img.SetPixelAsInt16({ 1, 2, 3 }, 7);
+  img.SetPixelAsInt16({ 9, 19, 29 }, -3);
+
+  const std::vector<uint32_t> indices = { 0, 0, 0, 1, 2, 3, 9, 19, 29 };
+
+  std::vector<int16_t> values = img.GetPixelsAsInt16(indices);
+  ASSERT_EQ(values.size(), 3u);
+  EXPECT_EQ(values[0], 0);
+  EXPECT_EQ(values[1], 7);
+  EXPECT_EQ(values[2], -3);
+
+  EXPECT_EQ(img.GetPixelsAsInt16({}).size(), 0u);
+  EXPECT_ANY_THROW(img.GetPixelsAsUInt16(indices)) << "Get with wrong type";
+  EXPECT_ANY_THROW(img.GetPixelsAsInt16({ 1, 2 })) << "Incomplete index";
+  EXPECT_ANY_THROW(img.GetPixelsAsInt16({ 1, 2, 3, 10, 0, 0 })) << "Index out of bounds";
+
+  sitk::Image copy = img;
+  copy.SetPixelsAsInt16(indices, { 11, 12, 13 });
+  EXPECT_EQ(copy.GetPixelAsInt16({ 0, 0, 0 }), 11);
+  EXPECT_EQ(copy.GetPixelAsInt16({ 1, 2, 3 }), 12);
+  EXPECT_EQ(copy.GetPixelAsInt16({ 9, 19, 29 }), 13);
+  EXPECT_EQ(img.GetPixelAsInt16({ 0, 0, 0 }), 0) << "Copy on write";
+
+  EXPECT_ANY_THROW(copy.SetPixelsAsInt16(indices, { 1, 2 })) << "Incorrect number of values";
+  EXPECT_ANY_THROW(copy.SetPixelsAsInt16({ 0, 0, 0, 0, 0, 30 }, { 1, 2 })) << "Index out of bounds";
+  EXPECT_EQ(copy.GetPixelAsInt16({ 0, 0, 0 }), 11) << "Unmodified after exception";
+
+  // vector pixels are accessed by component
+  sitk::Image vimg(std::vector<unsigned int>{ 5, 6 }, sitk::sitkVectorFloat32, 3);
+  vimg.SetPixelAsVectorFloat32({ 4, 5 }, { 1.0f, 2.0f, 3.0f });
+  vimg.SetPixelsAsFloat({ 0, 1 }, { 4.0f, 5.0f, 6.0f });
+  EXPECT_EQ(vimg.GetPixelsAsFloat({ 4, 5, 0, 1 }), std::vector<float>({ 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f }));
+  EXPECT_EQ(vimg.GetPixelAsVectorFloat32({ 0, 1 }), std::vector<float>({ 4.0f, 5.0f, 6.0f }));
+  EXPECT_ANY_THROW(vimg.SetPixelsAsFloat({ 0, 1 }, { 4.0f })) << "Incorrect number of components";
+
+  // complex pixels are accessed as real and imaginary components
+  sitk::Image cimg(5, 6, sitk::sitkComplexFloat64);
+  cimg.SetPixelsAsDouble({ 2, 3 }, { 1.5, -2.5 });
+  EXPECT_EQ(cimg.GetPixelAsComplexFloat64({ 2, 3 }), std::complex<double>(1.5, -2.5));
+  EXPECT_EQ(cimg.GetPixelsAsDouble({ 2, 3 }), std::vector<double>({ 1.5, -2.5 }));
+
+  sitk::Image limg(5, 6, sitk::sitkLabelUInt8);
+  limg.SetPixelsAsUInt8({ 1, 1, 2, 2 }, { 3, 4 });
+  EXPECT_EQ(limg.GetPixelAsUInt8({ 1, 1 }), 3);
+  EXPECT_EQ(limg.GetPixelsAsUInt8({ 2, 2, 0, 0, 1, 1 }), std::vector<uint8_t>({ 4, 0, 3 }));
+}
+
+
 TEST_F(Image, GetBufferVector)
 {
+  SITK_SKIP_IF_NOT_INSTANTIATED(sitk::sitkVectorInt8, sitk::sitkVectorUInt16, sitk::sitkVectorInt32);
 
   // this test is designed to run all GetBuffer methods for vector images
   sitk::Image img = sitk::Image(10, 10, sitk::sitkVectorUInt8);
@@ -2043,6 +2196,54 @@ TEST_F(Image, Evaluate_boundary)
   }
 }
 
+TEST_F(Image, EvaluateAtPhysicalPoints)
+{
+  sitk::Image img(10, 10, sitk::sitkFloat32);
+  for (unsigned int i = 0; i < 10; ++i)
+  {
+    for (unsigned int j = 0; j < 10; ++j)
+    {
+      img.SetPixelAsFloat({ i, j }, float(i + 10 * j));
+    }
+  }
+  img.SetSpacing({ 2.0, 0.5 });
+  img.SetOrigin({ -1.0, 1.0 });
+
+  const std::vector<double> points = { -1.0, 1.0, 2.0, 2.25, 17.0, 5.5, 5.0, 3.0 };
+
+  for (auto interp : { sitk::sitkNearestNeighbor, sitk::sitkLinear, sitk::sitkBSpline, sitk::sitkGaussian })
+  {
+    std::vector<double> result;
+    EXPECT_NO_THROW(result = img.EvaluateAtPhysicalPoints(points, interp));
+    ASSERT_EQ(result.size(), 4u);
+    for (unsigned int i = 0; i < 4; ++i)
+    {
+      const std::vector<double> pt(&points[2 * i], &points[2 * i + 2]);
+      EXPECT_NEAR(result[i], img.EvaluateAtPhysicalPoint(pt, interp)[0], 1e-10)
+        << " with interp as " << interp << " at point " << i;
+    }
+  }
+
+  EXPECT_TRUE(img.EvaluateAtPhysicalPoints({}).empty());
+  EXPECT_ANY_THROW(img.EvaluateAtPhysicalPoints({ 1.0, 2.0, 3.0 })) << "Incomplete point";
+  EXPECT_ANY_THROW(img.EvaluateAtPhysicalPoints({ 1.0, 2.0, -3.0, 2.0 })) << "Point outside the image";
+
+  img = sitk::Image({ 10, 10 }, sitk::sitkVectorFloat32, 3);
+  img.SetPixelAsVectorFloat32({ 2, 3 }, { 1.0f, 2.0f, 3.0f });
+  EXPECT_VECTOR_DOUBLE_NEAR(img.EvaluateAtPhysicalPoints({ 2.0, 3.0, 0.0, 0.0 }, sitk::sitkNearestNeighbor),
+                            std::vector<double>({ 1.0, 2.0, 3.0, 0.0, 0.0, 0.0 }),
+                            1e-10);
+  EXPECT_ANY_THROW(img.EvaluateAtPhysicalPoints({ 2.0, 3.0 }, sitk::sitkBSpline));
+
+  img = sitk::Image(10, 10, sitk::sitkComplexFloat64);
+  img.SetPixelAsComplexFloat64({ 2, 3 }, { 1.0, -1.0 });
+  EXPECT_VECTOR_DOUBLE_NEAR(
+    img.EvaluateAtPhysicalPoints({ 2.0, 3.0 }, sitk::sitkLinear), std::vector<double>({ 1.0, -1.0 }), 1e-10);
+
+  img = sitk::Image({ 3, 3 }, sitk::sitkLabelUInt8);
+  EXPECT_ANY_THROW(img.EvaluateAtPhysicalPoints({ 0.0, 0.0 }));
+}
+
 TEST_F(Image, ToVector)
 {
   for (auto pixelType : basicTypes)
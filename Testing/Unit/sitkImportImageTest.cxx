@@ -231,6 +231,56 @@ TEST_F(Import, Shallow)
   EXPECT_EQ(23, uint8_buffer[0]) << " image modifying buffer";
 }
 
+TEST_F(Import, Deleter)
+{
+
+  // This test is designed to verify the ownership of the buffer is
+  // transferred to the image
+
+  unsigned int numberOfDeletes = 0;
+  float *      buffer = new float[64 * 64 * 2];
+  std::fill(buffer, buffer + 64 * 64 * 2, 1.5f);
+
+  auto deleter = [&numberOfDeletes](void * p) {
+    ++numberOfDeletes;
+    delete[] static_cast<float *>(p);
+  };
+
+  {
+    sitk::ImportImageFilter importer;
+    importer.SetSize(std::vector<unsigned int>(2, 64u));
+    importer.SetBufferAsFloat(buffer, deleter, 2);
+
+    sitk::Image image = importer.Execute();
+    EXPECT_EQ(sitk::sitkVectorFloat32, image.GetPixelID());
+    EXPECT_EQ(2u, image.GetNumberOfComponentsPerPixel());
+    EXPECT_EQ(buffer, image.GetBufferAsFloat()) << " buffer is shared";
+
+    // the buffer has been passed to the image
+    EXPECT_ANY_THROW(importer.Execute());
+
+    sitk::Image copy = image;
+    image = sitk::Image();
+    EXPECT_EQ(0u, numberOfDeletes);
+    EXPECT_EQ(1.5f, copy.GetPixelAsVectorFloat32({ 3, 4 })[1]);
+  }
+  EXPECT_EQ(1u, numberOfDeletes) << " buffer released with the last image";
+
+  // a buffer not passed to an image is released by the filter
+  {
+    sitk::ImportImageFilter importer;
+    importer.SetSize(std::vector<unsigned int>(2, 64u));
+    importer.SetBufferAsFloat(new float[64 * 64], deleter);
+    importer.SetBufferAsFloat(new float[64 * 64], deleter);
+    EXPECT_EQ(2u, numberOfDeletes) << " replaced buffer released";
+  }
+  EXPECT_EQ(3u, numberOfDeletes) << " buffer released with the filter";
+
+  float                   value = 0.0f;
+  sitk::ImportImageFilter importer;
+  EXPECT_ANY_THROW(importer.SetBufferAsFloat(&value, sitk::ImportImageFilter::BufferDeleterType()));
+}
+
 TEST_F(Import, ExhaustiveTypes)
 {
 
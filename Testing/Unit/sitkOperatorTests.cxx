@@ -92,6 +92,8 @@ TEST(OperatorTests, BinaryLogic)
 
 TEST(OperatorTests, InPlaceException)
 {
+  SITK_SKIP_IF_NOT_INSTANTIATED(sitk::sitkInt8, sitk::sitkInt32);
+
   const std::string img1_hash = "ed4a77d1b56a118938788fc53037759b6c501e3d";
   sitk::Image       img1(10, 10, sitk::sitkInt8);
   img1.SetMetaData("test", "value");
@@ -113,6 +115,7 @@ TEST(OperatorTests, InPlaceException)
 
 TEST(OperatorTests, Arithmetic)
 {
+  SITK_SKIP_IF_NOT_INSTANTIATED(sitk::sitkInt32);
 
   sitk::Image img1(10, 10, sitk::sitkInt32);
   sitk::Image img2(10, 10, sitk::sitkInt32);
@@ -154,6 +157,7 @@ TEST(OperatorTests, Arithmetic)
 
 TEST(OperatorTests, AdditionalDivide)
 {
+  SITK_SKIP_IF_NOT_INSTANTIATED(sitk::sitkInt32);
 
   sitk::Image img1(10, 10, sitk::sitkInt32);
   sitk::Image img2(10, 10, sitk::sitkInt32);
@@ -364,6 +364,7 @@ TEST(TransformTest, CopyOnWrite)
 
 TEST(TransformTest, ReadTransformResample)
 {
+  SITK_SKIP_IF_NOT_INSTANTIATED(sitk::sitkInt16);
 
   const char * txFiles[] = {
     "Input/xforms/affine_i_3.txt",
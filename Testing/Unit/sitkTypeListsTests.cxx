@@ -98,6 +98,46 @@ TEST_F(TypeListTest, typelist)
   static_assert(has_type<t1, int>::value, "OK");
   static_assert(has_type<t1, char>::value, "OK");
   static_assert(has_type<t1, float>::value == false, "OK");
+
+  using t2 = typelist2::typelist<int, float, char, double>;
+  static_assert(std::is_same<filter<t2, std::is_integral>::type, typelist<int, char>>::value, "filter check");
+  static_assert(std::is_same<filter<t2, std::is_floating_point>::type, typelist<float, double>>::value, "filter check");
+  static_assert(length<filter<t2, std::is_pointer>::type>::value == 0, "filter length check");
+  static_assert(length<filter<typelist<>, std::is_pointer>::type>::value == 0, "filter length check");
+}
+
+
+TEST_F(TypeListTest, PixelTypesProfile)
+{
+  using namespace itk::simple;
+
+  // the required component types are in every build profile
+  static_assert(IsProfilePixelID<BasicPixelID<uint8_t>>::value, "required type");
+  static_assert(IsProfilePixelID<BasicPixelID<uint32_t>>::value, "required type");
+  static_assert(IsProfilePixelID<BasicPixelID<float>>::value, "required type");
+  static_assert(IsProfilePixelID<VectorPixelID<double>>::value, "required type");
+  static_assert(IsProfilePixelID<LabelPixelID<uint32_t>>::value, "required type");
+  static_assert(IsProfilePixelID<BasicPixelID<std::complex<double>>>::value, "required type");
+
+  static_assert(typelist2::has_type<InstantiatedPixelIDTypeList, BasicPixelID<uint8_t>>::value, "required type");
+  static_assert(typelist2::has_type<InstantiatedPixelIDTypeList, BasicPixelID<float>>::value, "required type");
+  static_assert(typelist2::has_type<InstantiatedPixelIDTypeList, VectorPixelID<double>>::value, "required type");
+
+#ifdef SITK_PIXEL_TYPE_INT16
+  static_assert(typelist2::has_type<InstantiatedPixelIDTypeList, BasicPixelID<int16_t>>::value, "profile type");
+  static_assert(typelist2::has_type<InstantiatedPixelIDTypeList, VectorPixelID<int16_t>>::value, "profile type");
+#else
+  static_assert(!typelist2::has_type<InstantiatedPixelIDTypeList, BasicPixelID<int16_t>>::value, "pruned type");
+  static_assert(!typelist2::has_type<InstantiatedPixelIDTypeList, VectorPixelID<int16_t>>::value, "pruned type");
+#endif
+
+#ifdef SITK_PIXEL_TYPE_UINT16
+  static_assert(typelist2::has_type<InstantiatedPixelIDTypeList, LabelPixelID<uint16_t>>::value, "profile type");
+#else
+  static_assert(!typelist2::has_type<InstantiatedPixelIDTypeList, LabelPixelID<uint16_t>>::value, "pruned type");
+#endif
+
+  EXPECT_LE(typelist2::length<InstantiatedPixelIDTypeList>::value, typelist2::length<AllPixelIDTypeList>::value);
 }
 
 
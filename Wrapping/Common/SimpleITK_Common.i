@@ -37,6 +37,24 @@
 %exception {
   try {
     $action
+  } catch( itk::simple::TimeoutException &ex ) {
+    const size_t e_size = 10240;
+    char error_msg[e_size];
+
+%#ifdef _MSC_VER
+    _snprintf_s( error_msg, e_size, e_size, "Timeout in SimpleITK $symname: %s", ex.what() );
+%#else
+    snprintf( error_msg, e_size, "Timeout in SimpleITK $symname: %s", ex.what() );
+%#endif
+
+%#ifdef SWIGPYTHON
+    // A TimeoutError is a subclass of OSError, distinct from the
+    // RuntimeError of other exceptions.
+    PyErr_SetString( PyExc_TimeoutError, error_msg );
+    SWIG_fail;
+%#else
+    SWIG_exception( SWIG_RuntimeError, error_msg );
+%#endif
   } catch( std::exception &ex ) {
     const size_t e_size = 10240;
     char error_msg[e_size];
@@ -118,6 +136,7 @@ namespace std
   %template(VectorOfTransform) vector< itk::simple::Transform >;
   %template(VectorUIntList) vector< vector<unsigned int> >;
   %template(VectorString) vector< std::string >;
+  %template(VectorOfExecutionStatisticsSummary) vector< itk::simple::ExecutionStatisticsSummary >;
 
   %template(DoubleDoubleMap) map<double, double>;
 }
@@ -171,6 +190,8 @@ namespace std
 %include "sitkPixelIDValues.h"
 %include "sitkInterpolator.h"
 %include "sitkImage.h"
+%include "sitkImageMemoryStatistics.h"
+%include "sitkBinaryMask.h"
 %include "sitkObjectOwnedBase.h"
 %include "sitkCommand.h"
 %include "sitkLogger.h"
@@ -198,6 +219,9 @@ namespace std
 
 
 // Basic Filter Base
+%include "sitkExecutionStatistics.h"
+%include "sitkExecutionTrace.h"
+%include "sitkResultCache.h"
 %include "sitkProcessObject.h"
 %include "sitkImageFilter.h"
 
@@ -206,7 +230,10 @@ namespace std
 %include "sitkImageFileWriter.h"
 %include "sitkImageSeriesWriter.h"
 %include "sitkImageReaderBase.h"
+%template(StringStringMap) std::map<std::string, std::string>;
+%template(VectorOfStringStringMap) std::vector< std::map<std::string, std::string> >;
 %include "sitkImageSeriesReader.h"
+%template(DICOMSeriesMap) std::map<std::string, itk::simple::DICOMSeries>;
 %include "sitkImageFileReader.h"
 %include "sitkImageViewer.h"
 
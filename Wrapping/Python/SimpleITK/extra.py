@@ -330,7 +330,8 @@ def GetImageFromArray(arr: "numpy.ndarray", isVector: Optional[bool] = None) ->
         shape = z.shape[::-1]
 
     # SimpleITK throws an exception if the image dimension is not supported
-    img = Image(shape, id, number_of_components)
+    # The buffer is not initialized as the array is copied into it
+    img = Image.CreateUninitialized(shape, id, number_of_components)
 
     _SetImageFromArray(z, img)
 
@@ -262,6 +262,9 @@
           else:
             P = (version, mv.tobytes(), origin, spacing, direction, metadata)
 
+          # The constructor zero fills the buffer which __setstate__
+          # overwrites, Image.CreateUninitialized is not used so that
+          # the pickles can be loaded by earlier versions.
           return self.__class__, (size, t, ncomponents), P
 
 
@@ -541,7 +544,11 @@
             index.
 
             Multi-dimension extended slice based indexing is also
-            implemented. The return is a copy of a new image. The
+            implemented. The return is a new image, which may share
+            the pixel buffer with this image when the slices have a
+            unit step and select a contiguous region, such as a single
+            slice of a volume. The shared buffer is copied before
+            either image is modified. The
             standard sliced based indices are supported including
             negative indices, to indicate location relative to the
             end, along with negative step sized to indicate reversing
@@ -646,6 +653,14 @@
               # extract each element of the indices rages together
               (start, stop, step) = zip(*sidx)
 
+              # A unit step region is extracted, which does not copy
+              # the pixels when the region is contiguous in the buffer
+              if all( st == 1 and b < e for b, e, st in sidx ):
+                size = [ e - b for b, e, st in sidx ]
+                for i in slice_dims:
+                  size[i] = 0
+                return Extract( self, size, start )
+
               # run the slice filter
               img = Slice(self, start=start, stop=stop, step=step)
 